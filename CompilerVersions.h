@@ -21,6 +21,29 @@
 // it's a good idea to #include it anyway for future use)
 /////////////////////////////////////////////////////////////////////////////
 
+///////////////////////////////////////////////////////////////////
+// STDEXT_EXPORT. Prefixes the (few) top-level declarations in this
+// header and "TypeTraits.h" (the "StdExt" namespace itself and
+// TCHAR), resolving to nothing by default. The module interface
+// unit "TypeTraits.ixx" #defines it as "export" before #including
+// these headers in its module purview, so that everything they
+// declare is exported from module "StdExt.TypeTraits" (see that
+// file for details). Don't #define it yourself.
+//
+// STDEXT_BEGIN_PRIVATE and STDEXT_END_PRIVATE. Open and close
+// each "Private" namespace nested in "StdExt" (in "TypeTraits.h"),
+// resolving to "namespace Private" and nothing by default. The
+// module purview in "TypeTraits.ixx" #defines them to close the
+// exported "StdExt" namespace first and reopen it afterwards,
+// so "StdExt::Private" isn't exported. Don't #define them
+// yourself either.
+///////////////////////////////////////////////////////////////////
+#if !defined(STDEXT_EXPORT)
+    #define STDEXT_EXPORT
+    #define STDEXT_BEGIN_PRIVATE namespace Private
+    #define STDEXT_END_PRIVATE
+#endif
+
 ///////////////////////////////////////////////////////////////////
 // GCC? (the real one - see https://stackoverflow.com/a/55926503)
 // 
@@ -225,8 +248,10 @@
     // UTF-16 where TCHAR is "wchar_t" but "char" is also
     // supported if compiled for ANSI). On non-MSFT
     // platforms however only "char" is supported for now.
+    // Note that TCHAR itself is declared at the end of
+    // this file, along with this header's other (non-macro)
+    // declarations (see "Declarations" there).
     ///////////////////////////////////////////////////////
-    using TCHAR = char; // IMPORTANT - Don't change this. See comments above.
 
     ////////////////////////////////////////////////////
     // Always char-based in this release. See comments
@@ -496,7 +521,89 @@
     #define CONCEPTS_SUPPORTED 0
 #endif
 
-namespace StdExt
+//////////////////////////////////////////////////////////////////
+// PACK_INDEXING_SUPPORTED and TYPE_PACK_ELEMENT_SUPPORTED.
+// #defined constants indicating whether C++26 pack indexing
+// ("Ts...[I]") is available, and whether the compiler intrinsic
+// "__type_pack_element<I, Ts...>" is available (Clang and GCC 14
+// or later at this writing). Either can be used to retrieve the
+// "Ith" type in a parameter pack without the recursive
+// instantiations most implementations of "std::tuple_element"
+// incur (callers normally test PACK_INDEXING_SUPPORTED first and
+// TYPE_PACK_ELEMENT_SUPPORTED second, falling back to their own
+// implementation if neither is available). Note that
+// "__has_builtin" isn't available on all supported compilers
+// (MSFT in particular) so we test for it first.
+//////////////////////////////////////////////////////////////////
+#if defined(__cpp_pack_indexing) && __cpp_pack_indexing >= 202311L
+    #define PACK_INDEXING_SUPPORTED 1
+#else
+    #define PACK_INDEXING_SUPPORTED 0
+#endif
+
+#if defined(__has_builtin)
+    #if __has_builtin(__type_pack_element)
+        #define TYPE_PACK_ELEMENT_SUPPORTED 1
+    #else
+        #define TYPE_PACK_ELEMENT_SUPPORTED 0
+    #endif
+#else
+    #define TYPE_PACK_ELEMENT_SUPPORTED 0
+#endif
+
+//////////////////////////////////////////////////////////////////
+// COROUTINES_SUPPORTED. #defined constant indicating whether
+// C++20 coroutines are supported by the compiler (the language
+// feature itself, i.e., "co_await" and friends, not the
+// "<coroutine>" header). Used to detect "operator co_await"
+// (which can't even be named otherwise) when determining if a
+// type is awaitable (see "IsReturnTypeAwaitable_v" in
+// "TypeTraits.h")
+//////////////////////////////////////////////////////////////////
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L
+    #define COROUTINES_SUPPORTED 1
+#else
+    #define COROUTINES_SUPPORTED 0
+#endif
+
+//////////////////////////////////////////////////////////////////
+// REFLECTION_SUPPORTED. #defined constant indicating whether
+// C++26 static reflection is supported by the compiler, i.e.,
+// the reflection operator ("^^T") and the "<meta>" header
+// (namespace "std::meta"). Used to retrieve type names directly
+// from the compiler instead of parsing __PRETTY_FUNCTION__ or
+// (for MSFT only) __FUNCSIG__ (see "TypeName_v" in
+// "TypeTraits.h"). Note that "__has_include" is always available
+// since C++17 or later is required.
+//////////////////////////////////////////////////////////////////
+#if defined(__cpp_impl_reflection) && __cpp_impl_reflection >= 202506L && __has_include(<meta>)
+    #define REFLECTION_SUPPORTED 1
+#else
+    #define REFLECTION_SUPPORTED 0
+#endif
+
+#endif // COMPILER_VERSIONS (#include guard for the macros above)
+
+//////////////////////////////////////////////////////////////////
+// Declarations. Everything above this point is macros only (and
+// native #includes), while everything below declares C++
+// entities. The latter has its own #include guard so that
+// module "StdExt.TypeTraits" can #include this header twice (see
+// "TypeTraits.ixx"), first in its global module fragment with
+// STDEXT_MACROS_ONLY #defined (picking up the macros only, since
+// declarations there aren't exported), and then in its module
+// purview, where only the following is processed (and exported).
+// Don't #define STDEXT_MACROS_ONLY yourself.
+//////////////////////////////////////////////////////////////////
+#if !defined(COMPILER_VERSIONS_DECLARATIONS) && !defined(STDEXT_MACROS_ONLY)
+#define COMPILER_VERSIONS_DECLARATIONS
+
+// Non-MSFT compilers only (see "_T" above)
+#if !defined(_MSC_VER)
+    STDEXT_EXPORT using TCHAR = char; // IMPORTANT - Don't change this. See comments for "_T" above.
+#endif
+
+STDEXT_EXPORT namespace StdExt
 {
     // "basic_string_view" not available until C++17
     #if CPP17_OR_LATER
@@ -567,4 +674,4 @@ namespace StdExt
     #endif // #if CPP17_OR_LATER
 }
 
-#endif // COMPILER_VERSIONS
\ No newline at end of file
+#endif // COMPILER_VERSIONS_DECLARATIONS
\ No newline at end of file
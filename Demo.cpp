@@ -231,6 +231,11 @@ void DisplayFunctionTraits()
     ///////////////////////////////
     tcoutNumBracket() << _T("Type: ") << FunctionTypeName_v<F> << _T("\n");
 
+    ///////////////////////////////
+    // #) Signature
+    ///////////////////////////////
+    tcoutNumBracket() << _T("Signature: ") << SignatureName_v<F> << _T("\n");
+
     ///////////////////////////////
     // #) Classification
     ///////////////////////////////
@@ -469,6 +474,30 @@ void DisplayFunctorTraits()
     DisplayFunctionTraits<F>(_T("Functor traits demo"));
 }
 
+//////////////////////////////////////////////////////////////////////////////
+// DisplayGenericLambdaTraits()
+//////////////////////////////////////////////////////////////////////////////
+void DisplayGenericLambdaTraits()
+{
+    ///////////////////////////////////////////////////////
+    // Generic lambda whose traits we wish to display. Its
+    // "operator()" is a template however, so it has no
+    // traits until it's specialized (and "FunctionTraits"
+    // can't target it directly). "OverloadType_t" returns
+    // the "operator()" specialization that a call with the
+    // given args would deduce instead (as a non-static
+    // member function pointer type), so for args "int &",
+    // "int" and "long" below that's "operator()(int, int &&,
+    // const long &) const" (note that "auto &&" deduces
+    // "int &&" for the "int" rvalue). Its traits can then
+    // be displayed like those of any other member function
+    ///////////////////////////////////////////////////////
+    const auto genericLambda = [](auto x, auto &&y, const auto &z) { return x + y + z; };
+    using F = OverloadType_t<decltype(genericLambda), int &, int, long>;
+
+    DisplayFunctionTraits<F>(_T("Generic lambda traits demo"));
+}
+
 /////////////////////////////////////////////////////////////////////////////
 // main()
 /////////////////////////////////////////////////////////////////////////////
@@ -480,6 +509,7 @@ int main()
     DisplayFreeFunctionTraits();
     DisplayMemberFunctionTraits();
     DisplayFunctorTraits();
+    DisplayGenericLambdaTraits();
 
     return 0;
 }
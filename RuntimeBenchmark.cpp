@@ -0,0 +1,420 @@
+/////////////////////////////////////////////////////////////////////////////
+// LICENSE NOTICE
+// --------------
+// Copyright (c) Hexadigm Systems
+//
+// Permission to use this software is granted under the following license:
+// https://www.hexadigm.com/GenericLib/License.html
+//
+// This copyright notice must be included in this and all copies of the
+// software as described in the above license.
+//
+// DESCRIPTION
+// -----------
+// Benchmark program measuring the runtime cost of the invokers, delegates
+// and dispatch tables declared in "TypeTraits.h" ("FunctionRef",
+// "Delegate", "ValueTraits::Invoke", "InvokeWithDecoder" and
+// "DispatchTable"), compared against direct calls, function pointers and
+// "std::function". Each row calls a function that is never inlined (of
+// arity 0, 3 and 8, and taking 64 byte args, declared with every
+// "CallingConvention" the compiler supports on free functions, plus a
+// member function declared with every "CallingConvention" supported on
+// non-static member functions) and displays the average time per call, along with the number of instructions and branch
+// mispredictions per call when hardware counters are available (Linux
+// only, via "perf_event_open", otherwise "n/a" is displayed). Build it
+// with optimizations on (the numbers are meaningless otherwise), for
+// instance:
+//
+//     g++ -std=c++17 -O2 RuntimeBenchmark.cpp -o RuntimeBenchmark
+//
+// and compare its output before and after changing "TypeTraits.h" to
+// catch regressions in the invoker layer. Note that "Direct call" is the
+// baseline for all others in the same group (everything else adds to it).
+//
+// For complete details on "FunctionTraits" (fully documented), see
+// https://github.com/HexadigmSystems/FunctionTraits
+/////////////////////////////////////////////////////////////////////////////
+
+// #included first so we can check CPP17_OR_LATER just below
+#include "CompilerVersions.h"
+
+// We only support C++17 or later (stop compiling otherwise)
+#if CPP17_OR_LATER
+
+// Standard C/C++ headers
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <tuple>
+#if defined(__linux__)
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+// Our headers
+#include "TypeTraits.h"
+
+////////////////////////////////////////
+// Everything in our own headers just
+// above is declared in this namespace
+////////////////////////////////////////
+using namespace StdExt;
+
+#if defined(_MSC_VER)
+    #define NOINLINE __declspec(noinline)
+#else
+    #define NOINLINE __attribute__((noinline))
+#endif
+
+constexpr std::size_t Iterations = 20'000'000;
+volatile std::uint64_t g_Sink; // Keeps results (and therefore calls) from being optimized away
+
+///////////////////////////////////////////////////////////
+// Hardware counter (Linux only, "n/a" reported otherwise
+// or if the kernel or VM doesn't expose the PMU)
+///////////////////////////////////////////////////////////
+class Counter
+{
+public:
+    explicit Counter(unsigned long long config)
+    {
+        #if defined(__linux__)
+            perf_event_attr attr{};
+            attr.size = sizeof(attr);
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = config;
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            m_Fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+        #endif
+    }
+
+    ~Counter()
+    {
+        #if defined(__linux__)
+            if (m_Fd >= 0)
+            {
+                close(m_Fd);
+            }
+        #endif
+    }
+
+    // Owns "m_Fd" (closed by the destructor)
+    Counter(const Counter &) = delete;
+    Counter &operator=(const Counter &) = delete;
+
+    void Start() { Control(true); }
+    void Stop() { Control(false); }
+
+    double PerCall() const // Negative if unavailable (displayed as "n/a")
+    {
+        long long value = -1;
+        #if defined(__linux__)
+            if (m_Fd < 0 || read(m_Fd, &value, sizeof(value)) != sizeof(value))
+            {
+                return -1;
+            }
+        #endif
+        return double(value) / Iterations;
+    }
+
+private:
+    void Control(bool start)
+    {
+        #if defined(__linux__)
+            if (m_Fd >= 0)
+            {
+                if (start)
+                {
+                    ioctl(m_Fd, PERF_EVENT_IOC_RESET, 0);
+                }
+                ioctl(m_Fd, start ? PERF_EVENT_IOC_ENABLE : PERF_EVENT_IOC_DISABLE, 0);
+            }
+        #endif
+        (void)start;
+    }
+
+    int m_Fd = -1;
+};
+
+#if !defined(__linux__)
+    #define PERF_COUNT_HW_INSTRUCTIONS 0
+    #define PERF_COUNT_HW_BRANCH_MISSES 0
+#endif
+
+template <typename CallT>
+void Run(const TCHAR *name, CallT call)
+{
+    for (std::size_t i = 0; i < Iterations / 10; ++i) // Warm up
+    {
+        g_Sink = g_Sink + call(i);
+    }
+
+    Counter instructions(PERF_COUNT_HW_INSTRUCTIONS);
+    Counter branchMisses(PERF_COUNT_HW_BRANCH_MISSES);
+    instructions.Start();
+    branchMisses.Start();
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < Iterations; ++i)
+    {
+        g_Sink = g_Sink + call(i);
+    }
+    const auto end = std::chrono::steady_clock::now();
+    branchMisses.Stop();
+    instructions.Stop();
+
+    const double ns = std::chrono::duration<double, std::nano>(end - start).count() / Iterations;
+    tcout << std::left << std::setw(40) << name << std::right << std::fixed << std::setprecision(2) << std::setw(8) << ns << _T(" ns");
+
+    const auto outputPerCall = [](const double perCall, const int precision, const TCHAR *units)
+                               {
+                                   tcout << std::setw(11);
+                                   if (perCall >= 0)
+                                   {
+                                       tcout << std::setprecision(precision) << perCall;
+                                   }
+                                   else
+                                   {
+                                       tcout << _T("n/a");
+                                   }
+                                   tcout << _T(" ") << units;
+                               };
+    outputPerCall(instructions.PerCall(), 2, _T("instr"));
+    outputPerCall(branchMisses.PerCall(), 4, _T("br-miss"));
+    tcout << _T("\n");
+}
+
+///////////////////////////////////////////////////////////
+// Targets (never inlined so every style pays for one call)
+///////////////////////////////////////////////////////////
+struct Blob { std::uint64_t m[8]; }; // 64 bytes
+Blob g_Blob; // Passed by reference (so never a temporary that goes out of scope)
+
+#define DEFINE_TARGETS(CC, SUFFIX)                                                                                           \
+    NOINLINE std::uint64_t CC Arity0##SUFFIX() noexcept { return 1; }                                                        \
+    NOINLINE std::uint64_t CC Arity3##SUFFIX(int a, int b, int c) noexcept { return a + b + c; }                             \
+    NOINLINE std::uint64_t CC Arity8##SUFFIX(int a, int b, int c, int d, int e, int f, int g, int h) noexcept                \
+    { return a + b + c + d + e + f + g + h; }                                                                                \
+    NOINLINE std::uint64_t CC Blobs##SUFFIX(const Blob &a, Blob b) noexcept { return a.m[0] + b.m[7]; }
+
+///////////////////////////////////////////////////////////
+// Calling conventions the target doesn't support (such as
+// "stdcall" on x86-64) are replaced with "cdecl" by the
+// compiler (see "CallingConventionReplacedWithCdecl()"),
+// which GCC, Clang and Intel warn about, so we turn these
+// warnings off while defining the targets (as
+// "TypeTraits.h" itself does for its own declarations).
+// The replaced targets are still benchmarked (displayed as
+// "compiled as Cdecl" - see "BenchmarkFree()" and
+// "BenchmarkMember()" below).
+///////////////////////////////////////////////////////////
+#if defined(GCC)
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wattributes" // E.g., "warning: 'stdcall' attribute ignored [-Wattributes]"
+#elif defined(__clang__)
+    #pragma clang diagnostic push
+    #pragma clang diagnostic ignored "-Wignored-attributes" // E.g., warning: 'stdcall' calling convention is not supported for this target [-Wignored-attributes]
+    #pragma clang diagnostic ignored "-Wunknown-attributes"
+#elif defined(__INTEL_COMPILER)
+    #pragma warning (push)
+    #pragma warning (disable:1292) // E.g., warning #1292: unknown attribute "vectorcall"
+    #pragma warning (disable:3706) // E.g., warning #3706: attribute is not supported in 64-bit x86 configurations
+#endif
+
+DEFINE_TARGETS(STDEXT_CC_CDECL, Cdecl)
+DEFINE_TARGETS(STDEXT_CC_STDCALL, Stdcall)
+DEFINE_TARGETS(STDEXT_CC_FASTCALL, Fastcall)
+DEFINE_TARGETS(STDEXT_CC_VECTORCALL, Vectorcall)
+#if defined(STDEXT_CC_REGCALL)
+    DEFINE_TARGETS(STDEXT_CC_REGCALL, Regcall)
+#endif
+
+#define DEFINE_MEMBER_TARGET(CC, SUFFIX) \
+    NOINLINE std::uint64_t CC Get##SUFFIX(int i) const noexcept { return m_Value + i; }
+
+struct Object
+{
+    std::uint64_t m_Value = 1;
+
+    DEFINE_MEMBER_TARGET(STDEXT_CC_CDECL, Cdecl)
+    DEFINE_MEMBER_TARGET(STDEXT_CC_STDCALL, Stdcall)
+    DEFINE_MEMBER_TARGET(STDEXT_CC_FASTCALL, Fastcall)
+    DEFINE_MEMBER_TARGET(STDEXT_CC_VECTORCALL, Vectorcall)
+    DEFINE_MEMBER_TARGET(STDEXT_CC_THISCALL, Thiscall)
+#if defined(STDEXT_CC_REGCALL)
+    DEFINE_MEMBER_TARGET(STDEXT_CC_REGCALL, Regcall)
+#endif
+};
+
+#if defined(GCC)
+    #pragma GCC diagnostic pop
+#elif defined(__clang__)
+    #pragma clang diagnostic pop
+#elif defined(__INTEL_COMPILER)
+    #pragma warning (pop)
+#endif
+
+#undef DEFINE_MEMBER_TARGET // Done with this
+#undef DEFINE_TARGETS // Done with this
+
+///////////////////////////////////////////////////////////
+// Decoder for "InvokeWithDecoder()" returning each arg
+// from a "std::tuple"
+///////////////////////////////////////////////////////////
+template <typename TupleT>
+struct TupleDecoder
+{
+    const TupleT &m_Args;
+
+    template <std::size_t I, typename ArgTypeT>
+    ArgTypeT operator()() const noexcept { return std::get<I>(m_Args); }
+};
+
+///////////////////////////////////////////////////////////
+// Runs every calling style for (free function) "F" whose
+// args for iteration "i" are returned (as a "std::tuple")
+// by "makeArgs(i)". Note that calling conventions the
+// target ignores (such as "stdcall" on x86-64) are
+// replaced by the compiler with the one it actually
+// uses (displayed after the declared one)
+///////////////////////////////////////////////////////////
+template <auto F, typename MakeArgsT>
+void BenchmarkFree(const TCHAR *name, tstring_view declaredCallingConvention, MakeArgsT makeArgs)
+{
+    using FunctionT = std::remove_pointer_t<decltype(F)>;
+    using PlainT = ReplaceCallingConvention_t<RemoveNoexcept_t<FunctionT>, CallingConvention::Cdecl>; // For "std::function"
+
+    FunctionT *volatile pointer = F; // "volatile" so the compiler can't see what it points to
+    const std::function<PlainT> function = [](auto &&... args) { return F(args...); };
+    const FunctionRef<FunctionT> functionRef(*F);
+    const Delegate<FunctionT> delegate(F);
+
+    tcout << name << _T(" (") << declaredCallingConvention;
+    if (declaredCallingConvention != CallingConventionName_v<FunctionT>)
+    {
+        tcout << _T(", compiled as ") << CallingConventionName_v<FunctionT>;
+    }
+    tcout << _T(")\n");
+    Run(_T("  Direct call"), [&](std::size_t i) { return std::apply(F, makeArgs(i)); });
+    Run(_T("  Function pointer"), [&](std::size_t i) { return std::apply(pointer, makeArgs(i)); });
+    Run(_T("  std::function"), [&](std::size_t i) { return std::apply(function, makeArgs(i)); });
+    Run(_T("  FunctionRef"), [&](std::size_t i) { return std::apply(functionRef, makeArgs(i)); });
+    Run(_T("  Delegate"), [&](std::size_t i) { return std::apply(delegate, makeArgs(i)); });
+    Run(_T("  ValueTraits::Invoke"), [&](std::size_t i) { return std::apply(ValueTraits<F>::Invoke, makeArgs(i)); });
+    Run(_T("  InvokeWithDecoder"), [&](std::size_t i) { const auto args = makeArgs(i); return InvokeWithDecoder(F, TupleDecoder<decltype(args)>{args}); });
+}
+
+#define BENCHMARK_TARGETS(SUFFIX)                                                                                 \
+    BenchmarkFree<&Arity0##SUFFIX>(_T("Arity 0"), _T(#SUFFIX), [](std::size_t) { return std::tuple<>(); });                        \
+    BenchmarkFree<&Arity3##SUFFIX>(_T("Arity 3"), _T(#SUFFIX), [](std::size_t i) { const int n = int(i); return std::tuple(n, n, n); }); \
+    BenchmarkFree<&Arity8##SUFFIX>(_T("Arity 8"), _T(#SUFFIX), [](std::size_t i) { const int n = int(i); return std::tuple(n, n, n, n, n, n, n, n); }); \
+    BenchmarkFree<&Blobs##SUFFIX>(_T("2 x 64 byte args"), _T(#SUFFIX), [](std::size_t i) { g_Blob.m[0] = i; return std::tuple<const Blob &, Blob>(g_Blob, g_Blob); });
+
+///////////////////////////////////////////////////////////
+// Runs every calling style for non-static member function
+// "F" of "Object" (taking an "int"). As in
+// "BenchmarkFree()", calling conventions the target
+// ignores are displayed after the declared one
+///////////////////////////////////////////////////////////
+template <auto F>
+void BenchmarkMember(tstring_view declaredCallingConvention)
+{
+    using FunctionT = decltype(F);
+
+    Object object;
+    const Object *volatile objectPointer = &object; // "volatile" so the compiler can't see what it points to
+    FunctionT volatile memberPointer = F; // Ditto
+    const Delegate<std::uint64_t (int) noexcept> delegate([objectPointer](int i) noexcept { return (objectPointer->*F)(i); });
+
+    tcout << _T("Member function (") << declaredCallingConvention;
+    if (declaredCallingConvention != CallingConventionName_v<FunctionT>)
+    {
+        tcout << _T(", compiled as ") << CallingConventionName_v<FunctionT>;
+    }
+    tcout << _T(")\n");
+    Run(_T("  Direct call"), [&](std::size_t i) { return (objectPointer->*F)(int(i)); });
+    Run(_T("  Member function pointer"), [&](std::size_t i) { return (objectPointer->*memberPointer)(int(i)); });
+    Run(_T("  Delegate (capturing lambda)"), [&](std::size_t i) { return delegate(int(i)); });
+    Run(_T("  ValueTraits::Invoke"), [&](std::size_t i) { return ValueTraits<F>::Invoke(*objectPointer, int(i)); });
+}
+
+#define BENCHMARK_MEMBER_TARGET(SUFFIX) BenchmarkMember<&Object::Get##SUFFIX>(_T(#SUFFIX));
+
+///////////////////////////////////////////////////////////
+// Dispatch table (4 handlers keyed on their message type)
+///////////////////////////////////////////////////////////
+template <std::size_t I> struct Message { std::uint64_t m_Value; };
+template <std::size_t I> NOINLINE void OnMessage(const Message<I> &message) noexcept { g_Sink = g_Sink + message.m_Value + I; }
+
+struct MessageDecoder
+{
+    std::uint64_t m_Value;
+
+    template <std::size_t I, typename ArgTypeT>
+    RemoveCvRef<ArgTypeT> operator()() const noexcept { return {m_Value}; }
+};
+
+using Router = DispatchTable<DispatchEntry<&OnMessage<0>>, DispatchEntry<&OnMessage<1>>,
+                             DispatchEntry<&OnMessage<2>>, DispatchEntry<&OnMessage<3>>>;
+
+constexpr std::uint64_t Keys[] = {TypeHash_v<Message<0>>, TypeHash_v<Message<1>>, TypeHash_v<Message<2>>, TypeHash_v<Message<3>>};
+
+int main()
+{
+    tcout << _T("FunctionTraits runtime benchmark (detected compiler: ") << GetCompilerName() << _T(", ") << Iterations << _T(" calls per row)\n\n");
+
+    BENCHMARK_TARGETS(Cdecl)
+    BENCHMARK_TARGETS(Stdcall)
+    BENCHMARK_TARGETS(Fastcall)
+    BENCHMARK_TARGETS(Vectorcall)
+#if defined(STDEXT_CC_REGCALL)
+    BENCHMARK_TARGETS(Regcall)
+#endif
+#undef BENCHMARK_TARGETS // Done with this
+
+    BENCHMARK_MEMBER_TARGET(Cdecl)
+    BENCHMARK_MEMBER_TARGET(Stdcall)
+    BENCHMARK_MEMBER_TARGET(Fastcall)
+    BENCHMARK_MEMBER_TARGET(Vectorcall)
+    BENCHMARK_MEMBER_TARGET(Thiscall)
+#if defined(STDEXT_CC_REGCALL)
+    BENCHMARK_MEMBER_TARGET(Regcall)
+#endif
+#undef BENCHMARK_MEMBER_TARGET // Done with this
+
+    tcout << _T("Dispatch (4 handlers, key varies per call)\n");
+    Run(_T("  if/else chain"), [&](std::size_t i) -> std::uint64_t {
+        const std::uint64_t key = Keys[(i * 7) & 3];
+        const MessageDecoder decoder{i};
+        if (key == Keys[0])
+        {
+            OnMessage<0>(decoder.operator()<0, Message<0>>());
+        }
+        else if (key == Keys[1])
+        {
+            OnMessage<1>(decoder.operator()<0, Message<1>>());
+        }
+        else if (key == Keys[2])
+        {
+            OnMessage<2>(decoder.operator()<0, Message<2>>());
+        }
+        else if (key == Keys[3])
+        {
+            OnMessage<3>(decoder.operator()<0, Message<3>>());
+        }
+        return 0;
+    });
+    Run(_T("  DispatchTable"), [&](std::size_t i) -> std::uint64_t { return Router::Dispatch(Keys[(i * 7) & 3], MessageDecoder{i}); });
+
+    return 0;
+}
+
+#else
+    #error "This program is only supported in C++17 or later (an earlier version was detected). Please set the appropriate compiler option to target C++17 or later and try again ("-std=c++17" in GCC, Clang and Intel, or "/std:c++17" in MSFT - later versions also supported of course)"
+#endif // CPP17_OR_LATER
@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+#############################################################################
+# LICENSE NOTICE
+# --------------
+# Copyright (c) Hexadigm Systems
+#
+# Permission to use this software is granted under the following license:
+# https://www.hexadigm.com/GenericLib/License.html
+#
+# This copyright notice must be included in this and all copies of the
+# software as described in the above license.
+#
+# DESCRIPTION
+# -----------
+# Groups the output of Clang's "-ftime-trace" option by "FunctionTraits"
+# helper template ("ArgType_t", "ReplaceNthArg_t", "TypeName_v",
+# "ForEachArg", etc.), so you can see which helpers (and which uses of
+# them) are responsible for the time spent compiling them. Compile your
+# code with STDEXT_TRAITS_PROFILE #defined (see this in "TypeTraits.h")
+# and "-ftime-trace", then pass the resulting ".json" files (or the folders
+# containing them) to this script:
+#
+#     clang++ -std=c++20 -DSTDEXT_TRAITS_PROFILE -ftime-trace -c MyFile.cpp
+#     python3 TraitsProfile.py MyFile.json
+#
+# For each helper it reports the number of instantiations and their total
+# duration (which includes the instantiations each one triggers, such as
+# "FunctionTraits" itself), followed by the helper's most expensive
+# template args (pass "--top" to change how many). Helpers whose same
+# template args appear in many translation units are normally the best
+# candidates for caching (in a precompiled header for instance).
+#############################################################################
+
+import argparse
+import collections
+import json
+import os
+import re
+import sys
+
+#############################################################################
+# Maps the (fully qualified) name of each instantiated template seen in
+# "-ftime-trace" output to the helper it belongs to. Most helpers are
+# seen by way of the class templates in namespace
+# "StdExt::Private::TraitsProfile" (which only exist when
+# STDEXT_TRAITS_PROFILE is #defined), and the others by their own name.
+#############################################################################
+HELPER_PATTERNS = [
+    (re.compile(r"^StdExt::Private::TraitsProfile::(\w+)<(.*)>$"), None),
+    (re.compile(r"^StdExt::Private::TypeNameImpl::Get<(.*)>$"), "TypeName_v"),
+    (re.compile(r"^StdExt::(ForEachArg|ForEachFunctionTraitsArg|ForEachTupleType|ForEach)<(.*)>$"), None),
+    (re.compile(r"^StdExt::FunctionTraits<(.*)>$"), "FunctionTraits"),
+]
+
+INSTANTIATION_EVENTS = ("InstantiateClass", "InstantiateFunction")
+
+def ToHelper(detail):
+    for pattern, helper in HELPER_PATTERNS:
+        match = pattern.match(detail)
+        if match:
+            if helper is None:
+                return match.group(1), match.group(2)
+            return helper, match.group(1)
+
+    return None, None
+
+def TraceFiles(paths):
+    for path in paths:
+        if os.path.isdir(path):
+            for root, _, files in os.walk(path):
+                for file in files:
+                    if file.endswith(".json"):
+                        yield os.path.join(root, file)
+        else:
+            yield path
+
+def main():
+    parser = argparse.ArgumentParser(description="Groups Clang -ftime-trace output by FunctionTraits helper template")
+    parser.add_argument("paths", nargs="+", help="-ftime-trace .json files (or folders containing them)")
+    parser.add_argument("--top", type=int, default=5, help="number of template args to list for each helper (default 5)")
+    args = parser.parse_args()
+
+    counts = collections.Counter()
+    durations = collections.Counter()
+    argDurations = collections.defaultdict(collections.Counter)
+    argCounts = collections.defaultdict(collections.Counter)
+
+    for file in TraceFiles(args.paths):
+        try:
+            with open(file, encoding="utf-8") as stream:
+                events = json.load(stream).get("traceEvents", [])
+        except (OSError, ValueError) as error:
+            print(f"Skipping {file}: {error}", file=sys.stderr)
+            continue
+
+        for event in events:
+            if event.get("name") not in INSTANTIATION_EVENTS:
+                continue
+
+            helper, templateArgs = ToHelper(event.get("args", {}).get("detail", ""))
+            if helper is None:
+                continue
+
+            duration = event.get("dur", 0) / 1000.0 # Microseconds to milliseconds
+            counts[helper] += 1
+            durations[helper] += duration
+            argDurations[helper][templateArgs] += duration
+            argCounts[helper][templateArgs] += 1
+
+    if not counts:
+        print("No FunctionTraits instantiations found (was STDEXT_TRAITS_PROFILE #defined?)")
+        return 1
+
+    print(f"{'Helper':<40}{'Instantiations':>16}{'Total (ms)':>14}")
+    for helper, duration in durations.most_common():
+        print(f"{helper:<40}{counts[helper]:>16}{duration:>14.1f}")
+        for templateArgs, argDuration in argDurations[helper].most_common(args.top):
+            print(f"    {argDuration:>10.1f} ms  x{argCounts[helper][templateArgs]:<5} <{templateArgs}>")
+
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -19,10 +19,10 @@
 // compilers only at this writing (C++17 and later - the check for
 // CPP17_OR_LATER just below causes all code to be preprocessed out
 // otherwise). Note that this file depends on (#includes)
-// "CompilerVersions.h" as well. All other dependencies are native C++
-// headers with the exception of the native Windows header "tchar.h" on MSFT
-// platforms, which must also be in the #include search path (and normally
-// will be). Note that all declarations in this file are in namespace
+// "CompilerVersions.h" and "TypeTraitsNativeHeaders.h" as well. All other
+// dependencies are native C++ headers with the exception of the native
+// Windows header "tchar.h" on MSFT platforms, which must also be in the
+// #include search path (and normally will be). Note that all declarations in this file are in namespace
 // "StdExt". Everything is available for public use except items declared in
 // (nested) namespace "StdExt::Private" (reserved for internal use), and in
 // some (limited) cases, certain macros outside of namespace "Private" (but
@@ -46,28 +46,19 @@
 //////////////////////////////////////////////////////////////
 #if CPP17_OR_LATER
 
-// Standard C/C++ headers
-#include <algorithm>
-#include <cstddef>
-#include <string_view>
-#include <tuple>
-#include <type_traits>
-#include <utility>
-
-/////////////////////////////////////////////////////////////
-// MSFT compiler? Note that Intel also #defines _MSC_VER on
-// Windows, as well as _MSC_FULL_VER and _MSC_EXTENSIONS.
-// See the following:
-//
-// https://github.com/cpredef/predef/blob/master/Compilers.md#user-content-microsoft-visual-c
-// https://www.intel.com/content/www/us/en/docs/cpp-compiler/developer-guide-reference/2021-8/additional-predefined-macros.html
-/////////////////////////////////////////////////////////////
-#if defined(_MSC_VER)
-    #include <tchar.h>
-#endif
+////////////////////////////////////////////////////////////////
+// All native headers we depend on (#included there and not
+// here, since module "StdExt.TypeTraits" must #include the
+// same ones in its global module fragment - see
+// "TypeTraits.ixx"). Also #defines TYPENAME_USES_REFLECTION
+// (see this there, as well as the STDEXT_USE_THREADS and
+// STDEXT_NO_REFLECTION constants you can #define)
+////////////////////////////////////////////////////////////////
+#include "TypeTraitsNativeHeaders.h"
 
-// Everything below in this namespace
-namespace StdExt
+// Everything below in this namespace (see STDEXT_EXPORT in
+// "CompilerVersions.h" for details about this macro)
+STDEXT_EXPORT namespace StdExt
 {
 
 /////////////////////////////////////////////////////
@@ -111,566 +102,873 @@ inline constexpr bool AlwaysTrue = true;
 // (std::basic_string_view). See "TypeName_v" for full details (it
 // just defers to "TypeNameImpl::Get()" in the following namespace).
 /////////////////////////////////////////////////////////////////////
-namespace Private
+STDEXT_BEGIN_PRIVATE
 {
-    //////////////////////////////////////////////////////////////////////
-    // Implementation class for variable template "TypeName_v" (declared
-    // just after this class but outside of this "Private" namespace so
-    // for public use). The latter variable just invokes static member
-    // "Get()" below which carries out all the work. See "TypeName_v" for
-    // complete details        
-    //
-    // IMPORTANT:
-    //  ---------
-    // Note that the implementation below relies on the predefined string
-    // __PRETTY_FUNCTION_ or (for MSFT only) __FUNCSIG__ (Google these
-    // for details). All implementations you can find on the web normally
-    // rely on these as does our own "Get()" member below, but unlike
-    // most other implementations I've seen, ours doesn't require any
-    // changes should you modify any part of the latter function's
-    // fully-qualified name or signature (affecting the value of the
-    // above predefined strings). Most other implementations I've seen
-    // would require changes, even though they should normally be very
-    // simple changes (trivial usually but changes nevertheless). Our
-    // implementation doesn't require any so users can move the following
-    // code to another namespace if they wish, change the function's
-    // class name or any part its signature without breaking anything
-    // (well, except for its "noexcept" specifier on MSFT platforms only,
-    // but nobody will ever need to change this regardless of platform).
-    // Note that the code is fairly small and clean notwithstanding first
-    // impressions, lengthy only because of the many comments (the code
-    // itself is fairly short and digestible however). It will only break
-    // normally if a compiler vendor makes a breaking change to
-    // __PRETTY_FUNCTION__ or (for MSFT only) __FUNCSIG__, but this will
-    // normally be caught by judicious use of "static_asserts" in the
-    // implementation and just after the following class itself (where we
-    // arbitrarily test it with a float to make sure it returns "float",
-    // a quick and dirty test but normally reliable)
-    //////////////////////////////////////////////////////////////////////
-    class TypeNameImpl
-    {
-    public:
-        ////////////////////////////////////////////////////////////////////
-        // Implementation function called by variable template "TypeName_v"
-        // (just after the "Private" namespace this class is declared in).
-        // The following function does all the work. See "TypeName_v" for
-        // details.
-        ////////////////////////////////////////////////////////////////////
-        template <typename T>
-        static constexpr tstring_view Get() noexcept
-        {
-            //////////////////////////////////////////////////////////
-            // Extract template arg "T" (whatever string it resolves
-            // to) from __PRETTY_FUNCTION__ or (for MSFT only)
-            // __FUNCSIG__. Returns it as a "tstring_view" which
-            // remains alive for the life of the app (since it's just
-            // a view into the latter string).
-            //////////////////////////////////////////////////////////
-            return GetPrettyFunction<T>().substr(GetTypeNameOffset(), // Offset of the type in __PRETTY_FUNCTION__
-                                                                      // or (for MSFT only) __FUNCSIG__
-                                                 GetTypeNameLen<T>()); // Length of the type in __PRETTY_FUNCTION__
-                                                                       // or (for MSFT only) __FUNCSIG__
-        }
-
-    private:
-        /////////////////////////////////////////////////////////////////////////////////
-        // GetPrettyFunction(). Returns the predefined string constant __PRETTY_FUNCTION__
-        // or (for MSFT only) __FUNCSIG__. Returns these as a "tstring_view" which lives
-        // for the life of the app (since it's just a view into the latter strings which
-        // are always static). Assuming template arg "T" is a float for instance, each
-        // resolves to the following (where the first three rows show the offsets for
-        // your guidance only, and the rows just after show the actual value of the
-        // above strings for the compilers we currently support):
-        //                                                                                                                                 1         1         1         1         1
-        //                                       1         2         3         4         5         6         7         8         9         0         1         2         3         4
-        //                             0123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901
-        //   Clang:                    static auto StdExt::Private::TypeNameImpl::GetPrettyFunction() [T = float]
-        //   GCC (1 of 2 - see below): static constexpr auto StdExt::Private::TypeNameImpl::GetPrettyFunction() [with T = float]
-        //   GCC (2 of 2 - see below): static constexpr tstring_view StdExt::Private::TypeNameImpl::GetPrettyFunction() [with T = float; tstring_view = std::basic_string_view<char>]
-        //   Intel:                    static constexpr auto StdExt::Private::TypeNameImpl::GetPrettyFunction() noexcept [with T = float]
-        //   Microsoft:                auto __cdecl StdExt::Private::TypeNameImpl::GetPrettyFunction<float>(void) noexcept
-        //
-        // GCC
-        // ---
-        // Note that unlike the other compilers, two possible formats exist for GCC as
-        // seen above (the others have one), where the one used depends on the return
-        // type of "GetPrettyFunction()" itself. GCC format "1 of 2" above is the one
-        // currently in effect at this writing since "GetPrettyFunction()" currently
-        // returns "auto", which just resolves to "std::basic_string_view<TCHAR>"
-        // (unless someone changed the return type since this writing which is safely
-        // handled but read on). Because "GetPrettyFunction()" is *not* returning an
-        // alias for another type in this case (it's returning "auto" which is not
-        // treated as an alias by GCC), GCC uses format "1 of 2". If the return type of
-        // "GetPrettyFunction()" is ever changed however so that it returns an alias
-        // instead, such as "tstring_view" seen in "2 of 2" above (which is an alias for
-        // "std::basic_string_view<TCHAR>" - note that TCHAR always resolves to "char"
-        // on GCC), then GCC uses format "2 of 2" above instead. In this case it displays
-        // (resolves) this alias at the end of __PRETTY_FUNCTION__ as seen. This refers
-        // to the "tstring_view = std::basic_string_view<char>" portion of the "2 of 2"
-        // string above. It removes this portion of the string in "1 of 2" however since
-        // the return value of "GetPrettyFunction()" is no longer returning an alias but
-        // "auto" (or you can change "auto" directly to "std::basic_string_view<TCHAR>"
-        // if you wish since it's still not an alias). The "tstring_view =
-        // std::basic_string_view<char>" portion of the "2 of 2" string is no longer
-        // required IOW since there's no "tstring_view" alias anymore, so GCC removes
-        // it. The upshot is that the offset to the type we're trying to extract from
-        // __PRETTY_FUNCTION__, a "float" in the above example but whatever the type is,
-        // can change depending on the return type of "GetPrettyFunction()" itself.
-        // Therefore, unlike the case for all other compilers we currently support,
-        // whose offset to the type is always at the same consistent location from the
-        // start of __PRETTY_FUNCTION__ or (for MSFT only) __FUNCSIG__, we need to check
-        // which format is in effect for GCC since we need (want) to protect against
-        // possible changes to the return type of "GetPrettyFunction()" itself.
-        // "GetTypeNameOffset()", which calculates the offset, therefore takes this
-        // situation into account for GCC only (checking which of these two formats is
-        // in effect).
-        //
-        // Reliance on "float"
-        // -------------------
-        // Note that float isn't just used for the examples above, it's also used by
-        // members "GetTypeNameOffset()" and "GetTypeNameLen()" below to determine the
-        // offset into each string of the type to extract, and the type's length, both
-        // of which are called by member "Get()" above to extract the type name from the
-        // string (for its template arg "T"). Since type float always returns "float"
-        // for all supported compilers (though any type whose string is the same for
-        // each compiler would do - read on), we can leverage this knowledge to easily
-        // determine the offset of type "T" and its length, regardless of what "T" is,
-        // without any complicated parsing of the above strings (in order to locate "T"
-        // within the string and determine its length). Note that parsing would be more
-        // complicated because type "T" itself can potentially contain any character
-        // including angled brackets, square brackets, equal signs, etc., each of which
-        // makes it harder to distinguish between those particular characters in "T"
-        // itself from their use as delimiters in the above strings (where they aren't
-        // part of "T"). It would usually be rare in practice but can happen. For
-        // instance, "T" might be a template type (class) called, say, "Bracket", with a
-        // non-template "char" arg so it can be instantiated (and therefore appear in
-        // __PRETTY_FUNCTION__ and __FUNCSIG__) like so (ignoring the class' namespace to
-        // keep things simple):
-        //
-        //      Bracket<'>'>
-        //      Bracket<']'>
-        //      Bracket<'='>
-        //      Bracket<';'>
+    // See this #defined constant for details
+    #if TYPENAME_USES_REFLECTION
+        //////////////////////////////////////////////////////////////////
+        // Implementation class for variable template "TypeName_v" when
+        // C++26 static reflection is available (see
+        // TYPENAME_USES_REFLECTION). The compiler then returns the name
+        // of "T" directly via "std::meta::display_string_of()", so none
+        // of the parsing of __PRETTY_FUNCTION__ (or __FUNCSIG__) seen in
+        // the #else version of this class below is required (nor is the
+        // latter string ever generated for each "T", which is much
+        // cheaper to compile). The name refers to a string with static
+        // storage duration so it remains valid for the life of the app,
+        // just as it does in the #else version.
         //
-        // This makes it more difficult to parse __PRETTY_FUNCTION__ and __FUNCSIG__
-        // looking for the above type and determining its length because the above
-        // strings contain the same characters used as delimiters elsewhere in
-        // __PRETTY_FUNCTION__ and __FUNCSIG__ (where applicable), so any parsing code
-        // will have to deal with this where required.
-        //
-        // To circumvent having to do this (parse the string and deal with this issue),
-        // there's a much easier alternative. For the offset of "T" itself, note that
-        // for each supported compiler it's always the same regardless of "T" (within
-        // that particular compiler). We can therefore simply rely on a known type like
-        // "float" to determine it, not "T" itself (since it will be the same for any
-        // "T" so we can arbitrarily use "float" - more on why "float" was chosen
-        // later). For the length of "T" however, we know that for any two different
-        // values of "T", say "int" and "float" (any two types will do), the "pretty"
-        // string containing "int" will be identical to the "pretty" string containing
-        // "float" except for the difference between "int" and "float" themselves.
-        // That's the only difference between these pretty strings, i.e., one contains
-        // "int" and one contains "float", but the remainder of the pretty strings are
-        // identical. Therefore, since the string "int" is 3 characters long and the
-        // string "float" is 5 characters long (2 characters longer than "int"), then
-        // the length of the pretty string above containing "int" must be shorter than
-        // the pretty string containing "float" by 2 characters, since the pretty
-        // strings themselves are identical except for the presence of "int" and "float"
-        // (within their respective pretty strings). So by simply subtracting the length
-        // of the pretty string for a "float" from the length of the pretty string for
-        // any type "T" (i.e., by simply computing this delta), we know how much longer
-        // (positive delta) or shorter (negative delta) the length of "T" must be
-        // compared to a "float", since the latter is always 5 characters long. We
-        // therefore just add this (positive or negative) delta to 5 to arrive at the
-        // length of "T" itself. For an "int" for instance, the delta is -2 (the length
-        // of its pretty string minus the length of the pretty string for "float" is
-        // always -2) so 5 - 2 = 3 is the length of an "int". For a type longer than "T"
-        // it works the same way only the delta is positive in this case. If an
-        // "unsigned int" for instance then the delta is 7 (length of its pretty string
-        // minus the length of the pretty string for "float" is always 7) so 5 + 7 = 12
-        // is the length of "unsigned int". We can do this for any arbitrary "T" of
-        // course to get its own length, by simply computing the delta for its pretty
-        // string in relation to the pretty string for a "float" as described.
-        //
-        // Note that float was chosen over other types we could have used instead since
-        // the name it generates in its own pretty string is always "float" for all our
-        // supported compilers. It's therefore consistent among all supported compilers
-        // and its length is always 5, both situations making it a reliable type to work
-        // with in the code below. In practice however all the fundamental types or even
-        // a particular user-defined type could have been used (each of which normally
-        // generates the same consistent string as well), but going forward "float"
-        // seemed (potentially) less vulnerable to issues like signedness among integral
-        // types, or other potential issues. If an integral type like "int" was chosen
-        // instead for instance (or "char", or "long", etc.), some future compiler (or
-        // compiler option) might display it as "int" within its pretty string, or maybe
-        // "signed int" or "unsigned int" depending on the default signedness in effect
-        // (so not always consistent among all compilers or possibly even within a given
-        // compiler depending on which compiler options are in effect at the time). Or
-        // perhaps a "double" might be displayed as "double" or "long double" based on
-        // some obscure compiler option so potentially not consistent either. Or perhaps
-        // a "bool" might appear as an "unsigned char" if some backwards compatibility
-        // option is turned on for some future compiler (since bools may have been
-        // internally declared that way once-upon-a-time and someone may turn the option
-        // on for backwards compatibility reasons if required). In reality it doesn't
-        // seem likely this is actually going to happen for any of the fundamental types
-        // however, and even "float" itself could potentially become a "double" under
-        // some unknown circumstance but for now it seems to be potentially more stable
-        // than the other fundamental types so I chose it for that reason only (even if
-        // these reasons are a bit flimsy).
-        /////////////////////////////////////////////////////////////////////////////////
-        template <typename T>
-        static constexpr auto GetPrettyFunction() noexcept
+        // Note that "FunctionTraits" itself doesn't rely on reflection,
+        // even when available, since it can't determine a function
+        // type's calling convention (or whether it's variadic in the
+        // C-style sense), and deducing its arg types via partial
+        // specialization (as "FunctionTraits" does) remains cheaper than
+        // forming them from reflections (via "std::meta::substitute()").
+        //////////////////////////////////////////////////////////////////
+        class TypeNameImpl
         {
-            #if defined(_MSC_VER)
-                return tstring_view(_T(__FUNCSIG__));
-            #elif defined(GCC) || defined(__clang__) || defined(__INTEL_COMPILER)
-                return tstring_view(__PRETTY_FUNCTION__);
-            #else
-                static_assert(false, "Unknown compiler in use. Only Clang, GCC, Intel and Microsoft are currently supported");
-                return tstring_view(); // Empty but need to return something to shut compiler up
-                                       // (but we always "static_assert" just above anyway)
-            #endif
-        }
-
+        public:
+            template <typename T>
+            static constexpr tstring_view Get() noexcept
+            {
+                return std::meta::display_string_of(^^T);
+            }
+        };
+    #else
         //////////////////////////////////////////////////////////////////////
-        // GetTypeNameOffset(). Returns the offset within __PRETTY_FUNCTION__
-        // or (for MSFT only) __FUNCSIG__ to the start of the type we need to
-        // extract from the latter strings (i.e., the offset to template arg
-        // "T" in the string returned by "GetPrettyFunction()" above). Note
-        // that as explained in the comments preceding "GetPrettyFunction()",
-        // (see this for details), the offset to the type's name within the
-        // latter strings is always identical regardless of the type so we
-        // can easily calculate it using any type. No need to do it for
-        // template arg "T" that is but we create the following function as a
-        // template anyway (with template arg "T"). We always pass "float"
-        // however (the default arg) but "T" is still required so we can
-        // "static_assert" in the code below without any "static_asserts"
-        // triggering when we don't want them to (where applicable). Because
-        // of how "static_assert" works in C++, if it's used outside a
-        // template-based context it will always trigger if its first arg is
-        // false. For instance, see the "if constexpr" clause in the GCC code
-        // below. When that condition is true, the "static_assert" in the
-        // "else" clause would trigger if this function wasn't a template
-        // because the arg being passed to "static_assert"" is false whenever
-        // the "if constexpr" condition itself is true. If not for the
-        // dependence on template arg "T" itself in the "static_assert" (its
-        // condition indirectly but ultimately depends on "T"), the
-        // "static_assert" would always trigger even when the "else" clause
-        // isn't in effect. Because of the function's dependence on a
-        // template arg however (that the "static_assert" itself depends on),
-        // it won't trigger, which is what we require. It's similar in nature
-        // to the reason behind the "AlwaysFalse" alias earlier in this
-        // header (see its comments). Ideally the following function
-        // shouldn't be a template since "T" will always be a "float" but in
-        // order to prevent the "static_assert" from always triggering as
-        // described we make it a template anyway. Note that we arbitrarily
-        // choose "float" as explained in the "GetPrettyFunction()" comments.
+        // Implementation class for variable template "TypeName_v" (declared
+        // just after this class but outside of this "Private" namespace so
+        // for public use). The latter variable just invokes static member
+        // "Get()" below which carries out all the work. See "TypeName_v" for
+        // complete details        
+        //
+        // IMPORTANT:
+        //  ---------
+        // Note that the implementation below relies on the predefined string
+        // __PRETTY_FUNCTION_ or (for MSFT only) __FUNCSIG__ (Google these
+        // for details). All implementations you can find on the web normally
+        // rely on these as does our own "Get()" member below, but unlike
+        // most other implementations I've seen, ours doesn't require any
+        // changes should you modify any part of the latter function's
+        // fully-qualified name or signature (affecting the value of the
+        // above predefined strings). Most other implementations I've seen
+        // would require changes, even though they should normally be very
+        // simple changes (trivial usually but changes nevertheless). Our
+        // implementation doesn't require any so users can move the following
+        // code to another namespace if they wish, change the function's
+        // class name or any part its signature without breaking anything
+        // (well, except for its "noexcept" specifier on MSFT platforms only,
+        // but nobody will ever need to change this regardless of platform).
+        // Note that the code is fairly small and clean notwithstanding first
+        // impressions, lengthy only because of the many comments (the code
+        // itself is fairly short and digestible however). It will only break
+        // normally if a compiler vendor makes a breaking change to
+        // __PRETTY_FUNCTION__ or (for MSFT only) __FUNCSIG__, but this will
+        // normally be caught by judicious use of "static_asserts" in the
+        // implementation and just after the following class itself (where we
+        // arbitrarily test it with a float to make sure it returns "float",
+        // a quick and dirty test but normally reliable)
         //////////////////////////////////////////////////////////////////////
-        template <typename T = float>
-        static constexpr tstring_view::size_type GetTypeNameOffset() noexcept
+        class TypeNameImpl
         {
-            // See comments above
-            static_assert(std::is_same_v<T, float>);
-
-            //////////////////////////////////////////////////////////////
-            // "T" is always float here (see "static_assert" just above
-            // and function comments above). Must pass "T" here instead
-            // of "float" directly however so that "prettyFunctionFloat"
-            // becomes dependent on a template arg (so any applicable
-            // "static_asserts" that depend on it below, either directly
-            // or indirectly, won't erroneously kick in when we don't
-            // want them to - see function comments above)
-            //////////////////////////////////////////////////////////////
-            constexpr tstring_view prettyFunctionFloat = GetPrettyFunction<T>();
-
-            // "basic_string_view::ends_with()" not available until C++20
-            #if CPP20_OR_LATER
-                #define PRETTY_FUNCTION_FLOAT_ENDS_WITH(END_STR) prettyFunctionFloat.ends_with(END_STR)
-            #else
-                ///////////////////////////////////////////////////////////////
-                // Quick and dirty equivalent of the C++20 code above but for
-                // our specific needs below only (so certain assumptions in
-                // effect, like the length of END_STR always being less than
-                // the length of "prettyFunctionFloat" so we don't safeguard
-                // against it being longer - it will always be shorter for our
-                // uses below unless something is seriously wrong, but this
-                // will result in a compiler error anyway - will never
-                // realistically happen though)
-                ///////////////////////////////////////////////////////////////
-                #define PRETTY_FUNCTION_FLOAT_ENDS_WITH(END_STR) prettyFunctionFloat.substr(prettyFunctionFloat.size() - tstring_view(END_STR).size()) == END_STR
-            #endif
+        public:
+            ////////////////////////////////////////////////////////////////////
+            // Implementation function called by variable template "TypeName_v"
+            // (just after the "Private" namespace this class is declared in).
+            // The following function does all the work. See "TypeName_v" for
+            // details.
+            ////////////////////////////////////////////////////////////////////
+            template <typename T>
+            static constexpr tstring_view Get() noexcept
+            {
+                //////////////////////////////////////////////////////////
+                // Extract template arg "T" (whatever string it resolves
+                // to) from __PRETTY_FUNCTION__ or (for MSFT only)
+                // __FUNCSIG__. Returns it as a "tstring_view" which
+                // remains alive for the life of the app (since it's just
+                // a view into the latter string).
+                //////////////////////////////////////////////////////////
+                return GetPrettyFunction<T>().substr(GetTypeNameOffset(), // Offset of the type in __PRETTY_FUNCTION__
+                                                                          // or (for MSFT only) __FUNCSIG__
+                                                     GetTypeNameLen<T>()); // Length of the type in __PRETTY_FUNCTION__
+                                                                           // or (for MSFT only) __FUNCSIG__
+            }
+
+        private:
+            /////////////////////////////////////////////////////////////////////////////////
+            // GetPrettyFunction(). Returns the predefined string constant __PRETTY_FUNCTION__
+            // or (for MSFT only) __FUNCSIG__. Returns these as a "tstring_view" which lives
+            // for the life of the app (since it's just a view into the latter strings which
+            // are always static). Assuming template arg "T" is a float for instance, each
+            // resolves to the following (where the first three rows show the offsets for
+            // your guidance only, and the rows just after show the actual value of the
+            // above strings for the compilers we currently support):
+            //                                                                                                                                 1         1         1         1         1
+            //                                       1         2         3         4         5         6         7         8         9         0         1         2         3         4
+            //                             0123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901
+            //   Clang:                    static auto StdExt::Private::TypeNameImpl::GetPrettyFunction() [T = float]
+            //   GCC (1 of 2 - see below): static constexpr auto StdExt::Private::TypeNameImpl::GetPrettyFunction() [with T = float]
+            //   GCC (2 of 2 - see below): static constexpr tstring_view StdExt::Private::TypeNameImpl::GetPrettyFunction() [with T = float; tstring_view = std::basic_string_view<char>]
+            //   Intel:                    static constexpr auto StdExt::Private::TypeNameImpl::GetPrettyFunction() noexcept [with T = float]
+            //   Microsoft:                auto __cdecl StdExt::Private::TypeNameImpl::GetPrettyFunction<float>(void) noexcept
+            //
+            // GCC
+            // ---
+            // Note that unlike the other compilers, two possible formats exist for GCC as
+            // seen above (the others have one), where the one used depends on the return
+            // type of "GetPrettyFunction()" itself. GCC format "1 of 2" above is the one
+            // currently in effect at this writing since "GetPrettyFunction()" currently
+            // returns "auto", which just resolves to "std::basic_string_view<TCHAR>"
+            // (unless someone changed the return type since this writing which is safely
+            // handled but read on). Because "GetPrettyFunction()" is *not* returning an
+            // alias for another type in this case (it's returning "auto" which is not
+            // treated as an alias by GCC), GCC uses format "1 of 2". If the return type of
+            // "GetPrettyFunction()" is ever changed however so that it returns an alias
+            // instead, such as "tstring_view" seen in "2 of 2" above (which is an alias for
+            // "std::basic_string_view<TCHAR>" - note that TCHAR always resolves to "char"
+            // on GCC), then GCC uses format "2 of 2" above instead. In this case it displays
+            // (resolves) this alias at the end of __PRETTY_FUNCTION__ as seen. This refers
+            // to the "tstring_view = std::basic_string_view<char>" portion of the "2 of 2"
+            // string above. It removes this portion of the string in "1 of 2" however since
+            // the return value of "GetPrettyFunction()" is no longer returning an alias but
+            // "auto" (or you can change "auto" directly to "std::basic_string_view<TCHAR>"
+            // if you wish since it's still not an alias). The "tstring_view =
+            // std::basic_string_view<char>" portion of the "2 of 2" string is no longer
+            // required IOW since there's no "tstring_view" alias anymore, so GCC removes
+            // it. The upshot is that the offset to the type we're trying to extract from
+            // __PRETTY_FUNCTION__, a "float" in the above example but whatever the type is,
+            // can change depending on the return type of "GetPrettyFunction()" itself.
+            // Therefore, unlike the case for all other compilers we currently support,
+            // whose offset to the type is always at the same consistent location from the
+            // start of __PRETTY_FUNCTION__ or (for MSFT only) __FUNCSIG__, we need to check
+            // which format is in effect for GCC since we need (want) to protect against
+            // possible changes to the return type of "GetPrettyFunction()" itself.
+            // "GetTypeNameOffset()", which calculates the offset, therefore takes this
+            // situation into account for GCC only (checking which of these two formats is
+            // in effect).
+            //
+            // Reliance on "float"
+            // -------------------
+            // Note that float isn't just used for the examples above, it's also used by
+            // members "GetTypeNameOffset()" and "GetTypeNameLen()" below to determine the
+            // offset into each string of the type to extract, and the type's length, both
+            // of which are called by member "Get()" above to extract the type name from the
+            // string (for its template arg "T"). Since type float always returns "float"
+            // for all supported compilers (though any type whose string is the same for
+            // each compiler would do - read on), we can leverage this knowledge to easily
+            // determine the offset of type "T" and its length, regardless of what "T" is,
+            // without any complicated parsing of the above strings (in order to locate "T"
+            // within the string and determine its length). Note that parsing would be more
+            // complicated because type "T" itself can potentially contain any character
+            // including angled brackets, square brackets, equal signs, etc., each of which
+            // makes it harder to distinguish between those particular characters in "T"
+            // itself from their use as delimiters in the above strings (where they aren't
+            // part of "T"). It would usually be rare in practice but can happen. For
+            // instance, "T" might be a template type (class) called, say, "Bracket", with a
+            // non-template "char" arg so it can be instantiated (and therefore appear in
+            // __PRETTY_FUNCTION__ and __FUNCSIG__) like so (ignoring the class' namespace to
+            // keep things simple):
+            //
+            //      Bracket<'>'>
+            //      Bracket<']'>
+            //      Bracket<'='>
+            //      Bracket<';'>
+            //
+            // This makes it more difficult to parse __PRETTY_FUNCTION__ and __FUNCSIG__
+            // looking for the above type and determining its length because the above
+            // strings contain the same characters used as delimiters elsewhere in
+            // __PRETTY_FUNCTION__ and __FUNCSIG__ (where applicable), so any parsing code
+            // will have to deal with this where required.
+            //
+            // To circumvent having to do this (parse the string and deal with this issue),
+            // there's a much easier alternative. For the offset of "T" itself, note that
+            // for each supported compiler it's always the same regardless of "T" (within
+            // that particular compiler). We can therefore simply rely on a known type like
+            // "float" to determine it, not "T" itself (since it will be the same for any
+            // "T" so we can arbitrarily use "float" - more on why "float" was chosen
+            // later). For the length of "T" however, we know that for any two different
+            // values of "T", say "int" and "float" (any two types will do), the "pretty"
+            // string containing "int" will be identical to the "pretty" string containing
+            // "float" except for the difference between "int" and "float" themselves.
+            // That's the only difference between these pretty strings, i.e., one contains
+            // "int" and one contains "float", but the remainder of the pretty strings are
+            // identical. Therefore, since the string "int" is 3 characters long and the
+            // string "float" is 5 characters long (2 characters longer than "int"), then
+            // the length of the pretty string above containing "int" must be shorter than
+            // the pretty string containing "float" by 2 characters, since the pretty
+            // strings themselves are identical except for the presence of "int" and "float"
+            // (within their respective pretty strings). So by simply subtracting the length
+            // of the pretty string for a "float" from the length of the pretty string for
+            // any type "T" (i.e., by simply computing this delta), we know how much longer
+            // (positive delta) or shorter (negative delta) the length of "T" must be
+            // compared to a "float", since the latter is always 5 characters long. We
+            // therefore just add this (positive or negative) delta to 5 to arrive at the
+            // length of "T" itself. For an "int" for instance, the delta is -2 (the length
+            // of its pretty string minus the length of the pretty string for "float" is
+            // always -2) so 5 - 2 = 3 is the length of an "int". For a type longer than "T"
+            // it works the same way only the delta is positive in this case. If an
+            // "unsigned int" for instance then the delta is 7 (length of its pretty string
+            // minus the length of the pretty string for "float" is always 7) so 5 + 7 = 12
+            // is the length of "unsigned int". We can do this for any arbitrary "T" of
+            // course to get its own length, by simply computing the delta for its pretty
+            // string in relation to the pretty string for a "float" as described.
+            //
+            // Note that float was chosen over other types we could have used instead since
+            // the name it generates in its own pretty string is always "float" for all our
+            // supported compilers. It's therefore consistent among all supported compilers
+            // and its length is always 5, both situations making it a reliable type to work
+            // with in the code below. In practice however all the fundamental types or even
+            // a particular user-defined type could have been used (each of which normally
+            // generates the same consistent string as well), but going forward "float"
+            // seemed (potentially) less vulnerable to issues like signedness among integral
+            // types, or other potential issues. If an integral type like "int" was chosen
+            // instead for instance (or "char", or "long", etc.), some future compiler (or
+            // compiler option) might display it as "int" within its pretty string, or maybe
+            // "signed int" or "unsigned int" depending on the default signedness in effect
+            // (so not always consistent among all compilers or possibly even within a given
+            // compiler depending on which compiler options are in effect at the time). Or
+            // perhaps a "double" might be displayed as "double" or "long double" based on
+            // some obscure compiler option so potentially not consistent either. Or perhaps
+            // a "bool" might appear as an "unsigned char" if some backwards compatibility
+            // option is turned on for some future compiler (since bools may have been
+            // internally declared that way once-upon-a-time and someone may turn the option
+            // on for backwards compatibility reasons if required). In reality it doesn't
+            // seem likely this is actually going to happen for any of the fundamental types
+            // however, and even "float" itself could potentially become a "double" under
+            // some unknown circumstance but for now it seems to be potentially more stable
+            // than the other fundamental types so I chose it for that reason only (even if
+            // these reasons are a bit flimsy).
+            /////////////////////////////////////////////////////////////////////////////////
+            template <typename T>
+            static constexpr auto GetPrettyFunction() noexcept
+            {
+                #if defined(_MSC_VER)
+                    return tstring_view(_T(__FUNCSIG__));
+                #elif defined(GCC) || defined(__clang__) || defined(__INTEL_COMPILER)
+                    return tstring_view(__PRETTY_FUNCTION__);
+                #else
+                    static_assert(false, "Unknown compiler in use. Only Clang, GCC, Intel and Microsoft are currently supported");
+                    return tstring_view(); // Empty but need to return something to shut compiler up
+                                           // (but we always "static_assert" just above anyway)
+                #endif
+            }
+
+            //////////////////////////////////////////////////////////////////////
+            // GetTypeNameOffset(). Returns the offset within __PRETTY_FUNCTION__
+            // or (for MSFT only) __FUNCSIG__ to the start of the type we need to
+            // extract from the latter strings (i.e., the offset to template arg
+            // "T" in the string returned by "GetPrettyFunction()" above). Note
+            // that as explained in the comments preceding "GetPrettyFunction()",
+            // (see this for details), the offset to the type's name within the
+            // latter strings is always identical regardless of the type so we
+            // can easily calculate it using any type. No need to do it for
+            // template arg "T" that is but we create the following function as a
+            // template anyway (with template arg "T"). We always pass "float"
+            // however (the default arg) but "T" is still required so we can
+            // "static_assert" in the code below without any "static_asserts"
+            // triggering when we don't want them to (where applicable). Because
+            // of how "static_assert" works in C++, if it's used outside a
+            // template-based context it will always trigger if its first arg is
+            // false. For instance, see the "if constexpr" clause in the GCC code
+            // below. When that condition is true, the "static_assert" in the
+            // "else" clause would trigger if this function wasn't a template
+            // because the arg being passed to "static_assert"" is false whenever
+            // the "if constexpr" condition itself is true. If not for the
+            // dependence on template arg "T" itself in the "static_assert" (its
+            // condition indirectly but ultimately depends on "T"), the
+            // "static_assert" would always trigger even when the "else" clause
+            // isn't in effect. Because of the function's dependence on a
+            // template arg however (that the "static_assert" itself depends on),
+            // it won't trigger, which is what we require. It's similar in nature
+            // to the reason behind the "AlwaysFalse" alias earlier in this
+            // header (see its comments). Ideally the following function
+            // shouldn't be a template since "T" will always be a "float" but in
+            // order to prevent the "static_assert" from always triggering as
+            // described we make it a template anyway. Note that we arbitrarily
+            // choose "float" as explained in the "GetPrettyFunction()" comments.
+            //////////////////////////////////////////////////////////////////////
+            template <typename T = float>
+            static constexpr tstring_view::size_type GetTypeNameOffset() noexcept
+            {
+                // See comments above
+                static_assert(std::is_same_v<T, float>);
+
+                //////////////////////////////////////////////////////////////
+                // "T" is always float here (see "static_assert" just above
+                // and function comments above). Must pass "T" here instead
+                // of "float" directly however so that "prettyFunctionFloat"
+                // becomes dependent on a template arg (so any applicable
+                // "static_asserts" that depend on it below, either directly
+                // or indirectly, won't erroneously kick in when we don't
+                // want them to - see function comments above)
+                //////////////////////////////////////////////////////////////
+                constexpr tstring_view prettyFunctionFloat = GetPrettyFunction<T>();
+
+                // "basic_string_view::ends_with()" not available until C++20
+                #if CPP20_OR_LATER
+                    #define PRETTY_FUNCTION_FLOAT_ENDS_WITH(END_STR) prettyFunctionFloat.ends_with(END_STR)
+                #else
+                    ///////////////////////////////////////////////////////////////
+                    // Quick and dirty equivalent of the C++20 code above but for
+                    // our specific needs below only (so certain assumptions in
+                    // effect, like the length of END_STR always being less than
+                    // the length of "prettyFunctionFloat" so we don't safeguard
+                    // against it being longer - it will always be shorter for our
+                    // uses below unless something is seriously wrong, but this
+                    // will result in a compiler error anyway - will never
+                    // realistically happen though)
+                    ///////////////////////////////////////////////////////////////
+                    #define PRETTY_FUNCTION_FLOAT_ENDS_WITH(END_STR) prettyFunctionFloat.substr(prettyFunctionFloat.size() - tstring_view(END_STR).size()) == END_STR
+                #endif
+
+                #if defined(_MSC_VER)
+                    ///////////////////////////////////////////////////////////////////
+                    // See format of __FUNCSIG__ string for "MSFT" near the top of the
+                    // comments in "GetPrettyFunction()". Offset to the type in this
+                    // string is the same regardless of the type so we arbitrarily
+                    // use "float" here (see comments preceding latter function for
+                    // details). The __FUNCSIG__ string with type "float" always ends
+                    // with "<float>(void) noexcept" so the offset to the "f" in this
+                    // string (i.e., the offset to the type we're after) is always 21
+                    // characters from the end (unless MSFT makes a breaking change
+                    // to the string). The offset will be the same no matter what the
+                    // type so we're good (i.e., we can just rely on the one for float
+                    // and immediately return this).
+                    ///////////////////////////////////////////////////////////////////
+                    static_assert(PRETTY_FUNCTION_FLOAT_ENDS_WITH(_T("<float>(void) noexcept")));
+
+                    //////////////////////////////////////////////////
+                    // Offset to the "f" in "<float>(void) noexcept"
+                    // (i.e., the 1st character of the type we're
+                    // after). Always the same regardless of the type
+                    // so our use of "float" to calculate it will
+                    // work no matter what the type.
+                    //////////////////////////////////////////////////
+                    return prettyFunctionFloat.size() - 21;
+                #elif defined(GCC)
+                    //////////////////////////////////////////////////////////////////
+                    // See format of __PRETTY_FUNCTION__ string for "GCC" near the
+                    // top of the comments in "GetPrettyFunction()". There are 2
+                    // possible formats labeled "1 of 2" and "2 of 2" in the comments
+                    // (with an explanation of when each kicks in - see comments for
+                    // details). The offset to the type in this string is the same
+                    // regardless of these two formats however (for whatever format
+                    // is in use), or the type itself, so we arbitrarily use float in
+                    // the code below (again, see comments in "GetPrettyFunction()"
+                    // for details). For format "1 of 2" the string always ends with
+                    // "= float]" so the offset to the "f" in this string (i.e., the
+                    // offset to the type we're after) is always 6 characters from
+                    // the end (unless the compiler vendor makes a breaking change to
+                    // the string but the "static_assert" below will trap this). This
+                    // is identical to the "Clang" and "Intel" case further below so
+                    // we do the same check here for GCC. If true then the offset
+                    // will be the same no matter what the type so we're good (i.e.,
+                    // we can just rely on the one for float and immediately return
+                    // this). Unlike "Clang" and "Intel" however, where this check
+                    // must always be true (or we "static_assert" for those compilers
+                    // if not), if it's not true for GCC then we must be dealing with
+                    // format "2 of 2" instead. In this case we need to locate "=
+                    // float;" within the string and the offset to the type itself is
+                    // therefore 2 characters after the '=' sign. Again, the offset
+                    // to the type will be the same no matter what the type so we're
+                    // good (we can just rely on the one for float and immediately
+                    // return this).
+                    //////////////////////////////////////////////////////////////////
+
+                    // GCC format 1 of 2 (see "GetPrettyFunction()" for details)
+                    if constexpr (PRETTY_FUNCTION_FLOAT_ENDS_WITH(_T("= float]")))
+                    {
+                        ///////////////////////////////////////////
+                        // Offset to the "f" in "= float]" (i.e.,
+                        // the 1st character of the type we're
+                        // after). Always the same regardless of
+                        // the type so our use of "float" here to
+                        // calculate it will work no matter what
+                        // the type.
+                        ///////////////////////////////////////////
+                        return prettyFunctionFloat.size() - 6;
+                    }
+                    else // GCC format 2 of 2 (see "GetPrettyFunction()" for details)
+                    {
+                        constexpr tstring_view::size_type offsetOfEqualSign = prettyFunctionFloat.rfind(_T("= float;"));
+                        static_assert(offsetOfEqualSign != tstring_view::npos);
+
+                        ///////////////////////////////////////////
+                        // Offset to the "f" in "= float;" (i.e.,
+                        // the 1st character of the type we're
+                        // after). Always the same regardless of
+                        // the type so our use of "float" above to
+                        // calculate it will work no matter what
+                        // the type.
+                        ///////////////////////////////////////////
+                        return offsetOfEqualSign + 2;
+                    }
+                #elif defined(__clang__) || defined(__INTEL_COMPILER)
+                    ///////////////////////////////////////////////////////////////////
+                    // See format of __PRETTY_FUNCTION__ string for Clang and Intel
+                    // near the top of the comments in "GetPrettyFunction()". Offset
+                    // to the type in this string is the same regardless of type so we
+                    // arbitrarily use "float" here (see latter comments for details).
+                    // The __PRETTY_FUNCTION__ string with type "float" always ends
+                    // with "= float]" so the offset to the "f" in this string (i.e.,
+                    // the offset to the type we're after) is always 6 characters from
+                    // the end (unless the compiler vendors makes a breaking change to
+                    // the string). The offset will be the same no matter what the
+                    // type so we're good (i.e., we can just rely on the one for float
+                    // and immediately return this).
+                    ///////////////////////////////////////////////////////////////////
+                    static_assert(PRETTY_FUNCTION_FLOAT_ENDS_WITH(_T("= float]")));
 
-            #if defined(_MSC_VER)
-                ///////////////////////////////////////////////////////////////////
-                // See format of __FUNCSIG__ string for "MSFT" near the top of the
-                // comments in "GetPrettyFunction()". Offset to the type in this
-                // string is the same regardless of the type so we arbitrarily
-                // use "float" here (see comments preceding latter function for
-                // details). The __FUNCSIG__ string with type "float" always ends
-                // with "<float>(void) noexcept" so the offset to the "f" in this
-                // string (i.e., the offset to the type we're after) is always 21
-                // characters from the end (unless MSFT makes a breaking change
-                // to the string). The offset will be the same no matter what the
-                // type so we're good (i.e., we can just rely on the one for float
-                // and immediately return this).
-                ///////////////////////////////////////////////////////////////////
-                static_assert(PRETTY_FUNCTION_FLOAT_ENDS_WITH(_T("<float>(void) noexcept")));
-
-                //////////////////////////////////////////////////
-                // Offset to the "f" in "<float>(void) noexcept"
-                // (i.e., the 1st character of the type we're
-                // after). Always the same regardless of the type
-                // so our use of "float" to calculate it will
-                // work no matter what the type.
-                //////////////////////////////////////////////////
-                return prettyFunctionFloat.size() - 21;
-            #elif defined(GCC)
-                //////////////////////////////////////////////////////////////////
-                // See format of __PRETTY_FUNCTION__ string for "GCC" near the
-                // top of the comments in "GetPrettyFunction()". There are 2
-                // possible formats labeled "1 of 2" and "2 of 2" in the comments
-                // (with an explanation of when each kicks in - see comments for
-                // details). The offset to the type in this string is the same
-                // regardless of these two formats however (for whatever format
-                // is in use), or the type itself, so we arbitrarily use float in
-                // the code below (again, see comments in "GetPrettyFunction()"
-                // for details). For format "1 of 2" the string always ends with
-                // "= float]" so the offset to the "f" in this string (i.e., the
-                // offset to the type we're after) is always 6 characters from
-                // the end (unless the compiler vendor makes a breaking change to
-                // the string but the "static_assert" below will trap this). This
-                // is identical to the "Clang" and "Intel" case further below so
-                // we do the same check here for GCC. If true then the offset
-                // will be the same no matter what the type so we're good (i.e.,
-                // we can just rely on the one for float and immediately return
-                // this). Unlike "Clang" and "Intel" however, where this check
-                // must always be true (or we "static_assert" for those compilers
-                // if not), if it's not true for GCC then we must be dealing with
-                // format "2 of 2" instead. In this case we need to locate "=
-                // float;" within the string and the offset to the type itself is
-                // therefore 2 characters after the '=' sign. Again, the offset
-                // to the type will be the same no matter what the type so we're
-                // good (we can just rely on the one for float and immediately
-                // return this).
-                //////////////////////////////////////////////////////////////////
-
-                // GCC format 1 of 2 (see "GetPrettyFunction()" for details)
-                if constexpr (PRETTY_FUNCTION_FLOAT_ENDS_WITH(_T("= float]")))
-                {
                     ///////////////////////////////////////////
                     // Offset to the "f" in "= float]" (i.e.,
                     // the 1st character of the type we're
                     // after). Always the same regardless of
-                    // the type so our use of "float" here to
+                    // the type so our use of "float" to
                     // calculate it will work no matter what
                     // the type.
                     ///////////////////////////////////////////
                     return prettyFunctionFloat.size() - 6;
+                #else
+                    static_assert(false, "Unknown compiler in use. Only Clang, GCC, Intel and Microsoft are currently supported");
+                    return tstring_view(); // Empty but need to return something to shut compiler up
+                                           // (but we always "static_assert" just above anyway)
+                #endif
+            }
+
+            //////////////////////////////////////////////////////////////////////
+            // GetTypeNameLen(). Returns the length of template arg "T" within
+            // __PRETTY_FUNCTION__ or (for MSFT only) __FUNCSIG__. If "T" is an
+            // int for instance and it actually appears in the latter string as
+            // "int" (always the case at this writing for all supported compilers
+            // but not guaranteed - "signed int" or "unsigned int" is always
+            // possible for future compilers), then it returns 3 (if it is in
+            // fact "int" - if it resolves to "signed int" for some reason then
+            // 10 would be returned of course, or if "unsigned int" then 12 would
+            // be returned). Note that as explained in the comments preceding
+            // function "GetPrettyFunction()" above, we leverage our knowledge of
+            // type float to help us calculate the length of "T". See
+            // "GetPrettyFunction()" for details.
+            //////////////////////////////////////////////////////////////////////
+            template <typename T>
+            static constexpr tstring_view::size_type GetTypeNameLen() noexcept
+            {
+                constexpr tstring_view prettyFunctionT = GetPrettyFunction<T>();
+                constexpr tstring_view prettyFunctionFloat = GetPrettyFunction<float>();
+
+                ///////////////////////////////////////////////////////////////
+                // See full explanation in "GetPrettyFunction()". The size of
+                // type "T" is determined by simply taking the difference in
+                // the length of the pretty function containing "float" and
+                // the length of the pretty function containg "T" itself
+                // (positive if length of "T" is greater than the length of
+                // "float" which is always 5, negative if less, zero if
+                // equal), and adding this to the length of "float" (again,
+                // always 5). "float" was chosen for this purpose but any type
+                // with a consistent size among all supported compilers will
+                // do. Again, see comments in "GetPrettyFunction()" for
+                // details.
+                //
+                // Lastly, note that since the following is dealing with
+                // unsigned numbers, I've coded things to avoid the possibility
+                // of a negative number when the length of the pretty strings
+                // are subtracted from each other. It's a confusing area for
+                // many, gets into the possibility of undefined behavior (won't
+                // talk about that here), etc. Therefore simpler to just code
+                // things as seen (whole situation avoided).
+                ///////////////////////////////////////////////////////////////
+
+                // Size of type "T" greater than "float" (i.e., > 5)
+                if constexpr (prettyFunctionT.size() > prettyFunctionFloat.size())
+                {
+                    return 5 + (prettyFunctionT.size() - prettyFunctionFloat.size());
                 }
-                else // GCC format 2 of 2 (see "GetPrettyFunction()" for details)
+                // Size of type "T" less than or equal to "float" (i.e., <= 5)
+                else
                 {
-                    constexpr tstring_view::size_type offsetOfEqualSign = prettyFunctionFloat.rfind(_T("= float;"));
-                    static_assert(offsetOfEqualSign != tstring_view::npos);
-
-                    ///////////////////////////////////////////
-                    // Offset to the "f" in "= float;" (i.e.,
-                    // the 1st character of the type we're
-                    // after). Always the same regardless of
-                    // the type so our use of "float" above to
-                    // calculate it will work no matter what
-                    // the type.
-                    ///////////////////////////////////////////
-                    return offsetOfEqualSign + 2;
+                    return 5 - (prettyFunctionFloat.size() - prettyFunctionT.size());
                 }
-            #elif defined(__clang__) || defined(__INTEL_COMPILER)
-                ///////////////////////////////////////////////////////////////////
-                // See format of __PRETTY_FUNCTION__ string for Clang and Intel
-                // near the top of the comments in "GetPrettyFunction()". Offset
-                // to the type in this string is the same regardless of type so we
-                // arbitrarily use "float" here (see latter comments for details).
-                // The __PRETTY_FUNCTION__ string with type "float" always ends
-                // with "= float]" so the offset to the "f" in this string (i.e.,
-                // the offset to the type we're after) is always 6 characters from
-                // the end (unless the compiler vendors makes a breaking change to
-                // the string). The offset will be the same no matter what the
-                // type so we're good (i.e., we can just rely on the one for float
-                // and immediately return this).
-                ///////////////////////////////////////////////////////////////////
-                static_assert(PRETTY_FUNCTION_FLOAT_ENDS_WITH(_T("= float]")));
-
-                ///////////////////////////////////////////
-                // Offset to the "f" in "= float]" (i.e.,
-                // the 1st character of the type we're
-                // after). Always the same regardless of
-                // the type so our use of "float" to
-                // calculate it will work no matter what
-                // the type.
-                ///////////////////////////////////////////
-                return prettyFunctionFloat.size() - 6;
-            #else
-                static_assert(false, "Unknown compiler in use. Only Clang, GCC, Intel and Microsoft are currently supported");
-                return tstring_view(); // Empty but need to return something to shut compiler up
-                                       // (but we always "static_assert" just above anyway)
-            #endif
-        }
+            }
+        };
+
+        ////////////////////////////////////////////////////////////
+        // MSFT? (though Intel will also #define this when running
+        // on Windows). Just a Visual Studio 2017 bug fix ...
+        ////////////////////////////////////////////////////////////
+        #if defined(_MSC_VER)
+            /////////////////////////////////////////////////
+            // Visual Studio 2017? (can't be earlier since
+            // CPP17_OR_LATER currently in effect from our
+            // check for it earlier - C++17 or later must
+            // therefore be in effect which wasn't supported
+            // in Visual Studio 2015 or earlier so if the
+            // following is true it must be VS 2017)
+            /////////////////////////////////////////////////
+            #if _MSC_VER < MSC_VER_2019
+                /////////////////////////////////////////////////////////
+                // The following code is only required in VS2017 due to
+                // a MSFT bug in that version (which I won't get into
+                // here). The bug was fixed in VS2019. If we ever stop
+                // supporting VS2017 then we can kill this code (and
+                // the code that relies on it later on)
+                /////////////////////////////////////////////////////////
+                static inline constexpr bool IsEqualTo(tstring_view typeName,
+                                                       tstring_view expectedTypeName) noexcept
+                {
+                    if (typeName.size() == expectedTypeName.size())
+                    {
+                        for (tstring_view::size_type i = 0; i < typeName.size(); ++i)
+                        {
+                            if (typeName[i] != expectedTypeName[i])
+                            {
+                                return false;
+                            }
+                        }
+
+                        return true;
+                    }
+                    else
+                    {
+                        return false;
+                    }
+                };
+            #endif // _MSC_VER < MSC_VER_2019
+        #endif // defined(_MSC_VER)
 
         //////////////////////////////////////////////////////////////////////
-        // GetTypeNameLen(). Returns the length of template arg "T" within
-        // __PRETTY_FUNCTION__ or (for MSFT only) __FUNCSIG__. If "T" is an
-        // int for instance and it actually appears in the latter string as
-        // "int" (always the case at this writing for all supported compilers
-        // but not guaranteed - "signed int" or "unsigned int" is always
-        // possible for future compilers), then it returns 3 (if it is in
-        // fact "int" - if it resolves to "signed int" for some reason then
-        // 10 would be returned of course, or if "unsigned int" then 12 would
-        // be returned). Note that as explained in the comments preceding
-        // function "GetPrettyFunction()" above, we leverage our knowledge of
-        // type float to help us calculate the length of "T". See
-        // "GetPrettyFunction()" for details.
+        // Sanity check only. The template, "TypeName_v" defined below, is
+        // brittle should any compiler vendor change the format of
+        // __PRETTY_FUNCTION__ or __FUNCSIG__ (MSFT) so that our assumption
+        // about its existing format no longer holds (or we ever encounter
+        // something different than what we expected given that its format is
+        // undocumented). "TypeName_v" could then potentially return an
+        // erroneous value, leading to potentially serious (hard-to-find)
+        // runtime bugs (including possible crashes). The following
+        // compile-time check therefore traps the situation by checking if
+        // the template (and hence its implementation function) works for
+        // type "float". It does this by simply checking that it returns
+        // "float" which I'm arbitrarily choosing since any type whose name
+        // is consistent among all our supported compilers will do (such as
+        // "float"). It doesn't have to be "float" IOW since other types will
+        // also work (see "TypeNameImpl::GetPrettyFunction()" above for
+        // further details).
+        //
+        // In any case, if "TypeName_v<float>" doesn't return "float" then
+        // the following "static_assert" will trigger. It normally means that
+        // the compiler vendor changed the format of __PRETTY_FUNCTION__ or
+        // (for MSFT only) __FUNCSIG__, assuming no errors in our
+        // understanding of this string's undocumented format. Note that it's
+        // not a fullproof check though (longer story), the implementation
+        // above will normally "static_assert" anyway (making the following
+        // one superfluous usually), and it's really just a hack, but in
+        // reality it will normally be reliable. The upshot is that if
+        // "TypeName_v" ever starts returning a different name for "float"
+        // than it did at the time "TypeName_v" was written, and our
+        // implementation above doesn't already "static_assert" as a result,
+        // then the following "static_assert" will almost certainly be
+        // triggered (by itself or in addition to those in the implementation
+        // above). You'll then have to review the implementation above to
+        // correct the situation.
         //////////////////////////////////////////////////////////////////////
-        template <typename T>
-        static constexpr tstring_view::size_type GetTypeNameLen() noexcept
+        static_assert(
+                       ////////////////////////////////////////////////////
+                        // True for all compilers we support except Visual
+                        // Studio 2017. See #else comments below
+                        ////////////////////////////////////////////////////
+                       #if !defined(_MSC_VER) || _MSC_VER >= MSC_VER_2019 
+                           TypeNameImpl::Get<float>() == _T("float"), // Make sure "TypeName_v()" returns "float" (literally, though
+                                                                       // it's returned as a "tstring_view"). See long comments above.
+    
+                       //////////////////////////////////////////////////////
+                        // Visual Studio 2017 only. Call just above should
+                        // also work but fails due to a MSFT bug (in VS2017).
+                        // The following is a work-around ...
+                        //////////////////////////////////////////////////////
+                       #else
+                           IsEqualTo(TypeName_v<float>, _T("float")),
+                       #endif
+                       "A breaking change was detected in template \"TypeNameImpl::Get()\". The format of the "
+                       "predefined string __PRETTY_FUNCTION__ or (for MSFT) __FUNCSIG__ was likely changed by "
+                       "the compiler vendor (though would be very rare). \"TypeNameImpl::Get()\" was (arbitrarily) "
+                       "tested with type float but the returned string isn't \"float\" and normally should be. "
+                       "The format of __PRETTY_FUNCTION__ (or __FUNCSIG__) was therefore (likely) changed since "
+                       "\"TypeNameImpl::Get()\"was written, so its implementation should be reviewed and corrected.");
+    #endif // TYPENAME_USES_REFLECTION
+} // namespace Private
+STDEXT_END_PRIVATE
+
+#undef TYPENAME_USES_REFLECTION // Done with this
+
+/////////////////////////////////////////////////////////////////////////////
+// FixedString. Compile-time string stored in a fixed-size array of "N"
+// characters (plus a terminating null character which isn't included in
+// "N"). Unlike "std::basic_string_view", which only refers to characters
+// stored elsewhere, "FixedString" stores the characters themselves, so
+// a "constexpr" (static) instance can be used to store a string computed
+// at compile time, such as a substring of some (possibly much longer)
+// string literal, without keeping the latter around (see
+// "TypeNameFixed_v" below for instance). Normally used via its
+// conversion to "std::basic_string_view<CharT>" (or "View()").
+/////////////////////////////////////////////////////////////////////////////
+template <typename CharT,
+          std::size_t N>
+struct FixedString
+{
+    //////////////////////////////////////////////////////////
+    // Converting constructor. Copies the first "N" characters
+    // of "str" (which must have at least "N" characters)
+    // Note that each character is converted to "CharT" via a
+    // "static_cast" so "str" can be any (compatible) character
+    // type.
+    //////////////////////////////////////////////////////////
+    template <typename SourceCharT>
+    constexpr FixedString(std::basic_string_view<SourceCharT> str) noexcept
+    {
+        for (std::size_t i = 0; i < N; ++i)
         {
-            constexpr tstring_view prettyFunctionT = GetPrettyFunction<T>();
-            constexpr tstring_view prettyFunctionFloat = GetPrettyFunction<float>();
-
-            ///////////////////////////////////////////////////////////////
-            // See full explanation in "GetPrettyFunction()". The size of
-            // type "T" is determined by simply taking the difference in
-            // the length of the pretty function containing "float" and
-            // the length of the pretty function containg "T" itself
-            // (positive if length of "T" is greater than the length of
-            // "float" which is always 5, negative if less, zero if
-            // equal), and adding this to the length of "float" (again,
-            // always 5). "float" was chosen for this purpose but any type
-            // with a consistent size among all supported compilers will
-            // do. Again, see comments in "GetPrettyFunction()" for
-            // details.
-            //
-            // Lastly, note that since the following is dealing with
-            // unsigned numbers, I've coded things to avoid the possibility
-            // of a negative number when the length of the pretty strings
-            // are subtracted from each other. It's a confusing area for
-            // many, gets into the possibility of undefined behavior (won't
-            // talk about that here), etc. Therefore simpler to just code
-            // things as seen (whole situation avoided).
-            ///////////////////////////////////////////////////////////////
-
-            // Size of type "T" greater than "float" (i.e., > 5)
-            if constexpr (prettyFunctionT.size() > prettyFunctionFloat.size())
+            m_Chars[i] = static_cast<CharT>(str[i]);
+        }
+    }
+
+    constexpr std::basic_string_view<CharT> View() const noexcept
+    {
+        return std::basic_string_view<CharT>(m_Chars, N);
+    }
+
+    constexpr operator std::basic_string_view<CharT>() const noexcept
+    {
+        return View();
+    }
+
+    // Null-terminated string
+    constexpr const CharT *c_str() const noexcept
+    {
+        return m_Chars;
+    }
+
+    static constexpr std::size_t size() noexcept
+    {
+        return N;
+    }
+
+    CharT m_Chars[N + 1] = {};
+};
+
+STDEXT_BEGIN_PRIVATE
+{
+    //////////////////////////////////////////////////////////////////
+    // Compile-time Unicode transcoding used by "TypeName_v" when its
+    // "CharT" template arg isn't TCHAR (see "TypeName_v" below).
+    // Strings of 1-byte characters (normally "char" or "char8_t")
+    // are treated as UTF-8, 2-byte characters (normally "char16_t",
+    // or "wchar_t" on MSFT platforms) as UTF-16, and 4-byte
+    // characters (normally "char32_t", or "wchar_t" on non-MSFT
+    // platforms) as UTF-32. Invalid sequences are replaced with
+    // U+FFFD (the Unicode replacement character). Note that type
+    // names are almost always pure ASCII in practice (so each
+    // character is simply copied), but identifiers may legally
+    // contain other characters as well (since C++23).
+    //////////////////////////////////////////////////////////////////
+    struct DecodedCodePoint
+    {
+        char32_t CodePoint;
+        std::size_t Length; // Number of (source) characters consumed
+    };
+
+    inline constexpr char32_t ReplacementCodePoint = 0xFFFD;
+
+    template <typename CharT>
+    inline constexpr DecodedCodePoint DecodeCodePoint(const std::basic_string_view<CharT> str, const std::size_t i) noexcept
+    {
+        if constexpr (sizeof(CharT) == 1)
+        {
+            const char32_t lead = static_cast<unsigned char>(str[i]);
+            const std::size_t length = lead < 0x80 ? 1
+                                     : (lead >> 5) == 0x06 ? 2
+                                     : (lead >> 4) == 0x0E ? 3
+                                     : (lead >> 3) == 0x1E ? 4
+                                     : 0;
+            if (length == 0 || i + length > str.size())
             {
-                return 5 + (prettyFunctionT.size() - prettyFunctionFloat.size());
+                return {ReplacementCodePoint, 1};
             }
-            // Size of type "T" less than or equal to "float" (i.e., <= 5)
-            else
+
+            char32_t codePoint = length == 1 ? lead : lead & (0x7F >> length);
+            for (std::size_t j = 1; j < length; ++j)
             {
-                return 5 - (prettyFunctionFloat.size() - prettyFunctionT.size());
+                const char32_t trail = static_cast<unsigned char>(str[i + j]);
+                if ((trail >> 6) != 0x02)
+                {
+                    return {ReplacementCodePoint, j};
+                }
+
+                codePoint = (codePoint << 6) | (trail & 0x3F);
             }
-        }
-    };
 
-    ////////////////////////////////////////////////////////////
-    // MSFT? (though Intel will also #define this when running
-    // on Windows). Just a Visual Studio 2017 bug fix ...
-    ////////////////////////////////////////////////////////////
-    #if defined(_MSC_VER)
-        /////////////////////////////////////////////////
-        // Visual Studio 2017? (can't be earlier since
-        // CPP17_OR_LATER currently in effect from our
-        // check for it earlier - C++17 or later must
-        // therefore be in effect which wasn't supported
-        // in Visual Studio 2015 or earlier so if the
-        // following is true it must be VS 2017)
-        /////////////////////////////////////////////////
-        #if _MSC_VER < MSC_VER_2019
-            /////////////////////////////////////////////////////////
-            // The following code is only required in VS2017 due to
-            // a MSFT bug in that version (which I won't get into
-            // here). The bug was fixed in VS2019. If we ever stop
-            // supporting VS2017 then we can kill this code (and
-            // the code that relies on it later on)
-            /////////////////////////////////////////////////////////
-            static inline constexpr bool IsEqualTo(tstring_view typeName,
-                                                   tstring_view expectedTypeName) noexcept
+            return {codePoint, length};
+        }
+        else if constexpr (sizeof(CharT) == 2)
+        {
+            const char32_t lead = static_cast<char16_t>(str[i]);
+            if (lead < 0xD800 || lead > 0xDFFF)
             {
-                if (typeName.size() == expectedTypeName.size())
-                {
-                    for (tstring_view::size_type i = 0; i < typeName.size(); ++i)
-                    {
-                        if (typeName[i] != expectedTypeName[i])
-                        {
-                            return false;
-                        }
-                    }
+                return {lead, 1};
+            }
 
-                    return true;
-                }
-                else
+            if (lead <= 0xDBFF && i + 1 < str.size())
+            {
+                const char32_t trail = static_cast<char16_t>(str[i + 1]);
+                if (trail >= 0xDC00 && trail <= 0xDFFF)
                 {
-                    return false;
+                    return {0x10000 + ((lead - 0xD800) << 10) + (trail - 0xDC00), 2};
                 }
-            };
-        #endif // _MSC_VER < MSC_VER_2019
-    #endif // defined(_MSC_VER)
-
-    //////////////////////////////////////////////////////////////////////
-    // Sanity check only. The template, "TypeName_v" defined below, is
-    // brittle should any compiler vendor change the format of
-    // __PRETTY_FUNCTION__ or __FUNCSIG__ (MSFT) so that our assumption
-    // about its existing format no longer holds (or we ever encounter
-    // something different than what we expected given that its format is
-    // undocumented). "TypeName_v" could then potentially return an
-    // erroneous value, leading to potentially serious (hard-to-find)
-    // runtime bugs (including possible crashes). The following
-    // compile-time check therefore traps the situation by checking if
-    // the template (and hence its implementation function) works for
-    // type "float". It does this by simply checking that it returns
-    // "float" which I'm arbitrarily choosing since any type whose name
-    // is consistent among all our supported compilers will do (such as
-    // "float"). It doesn't have to be "float" IOW since other types will
-    // also work (see "TypeNameImpl::GetPrettyFunction()" above for
-    // further details).
-    //
-    // In any case, if "TypeName_v<float>" doesn't return "float" then
-    // the following "static_assert" will trigger. It normally means that
-    // the compiler vendor changed the format of __PRETTY_FUNCTION__ or
-    // (for MSFT only) __FUNCSIG__, assuming no errors in our
-    // understanding of this string's undocumented format. Note that it's
-    // not a fullproof check though (longer story), the implementation
-    // above will normally "static_assert" anyway (making the following
-    // one superfluous usually), and it's really just a hack, but in
-    // reality it will normally be reliable. The upshot is that if
-    // "TypeName_v" ever starts returning a different name for "float"
-    // than it did at the time "TypeName_v" was written, and our
-    // implementation above doesn't already "static_assert" as a result,
-    // then the following "static_assert" will almost certainly be
-    // triggered (by itself or in addition to those in the implementation
-    // above). You'll then have to review the implementation above to
-    // correct the situation.
-    //////////////////////////////////////////////////////////////////////
-    static_assert(
-                   ////////////////////////////////////////////////////
-                    // True for all compilers we support except Visual
-                    // Studio 2017. See #else comments below
-                    ////////////////////////////////////////////////////
-                   #if !defined(_MSC_VER) || _MSC_VER >= MSC_VER_2019 
-                       TypeNameImpl::Get<float>() == _T("float"), // Make sure "TypeName_v()" returns "float" (literally, though
-                                                                   // it's returned as a "tstring_view"). See long comments above.
-    
-                   //////////////////////////////////////////////////////
-                    // Visual Studio 2017 only. Call just above should
-                    // also work but fails due to a MSFT bug (in VS2017).
-                    // The following is a work-around ...
-                    //////////////////////////////////////////////////////
-                   #else
-                       IsEqualTo(TypeName_v<float>, _T("float")),
-                   #endif
-                   "A breaking change was detected in template \"TypeNameImpl::Get()\". The format of the "
-                   "predefined string __PRETTY_FUNCTION__ or (for MSFT) __FUNCSIG__ was likely changed by "
-                   "the compiler vendor (though would be very rare). \"TypeNameImpl::Get()\" was (arbitrarily) "
-                   "tested with type float but the returned string isn't \"float\" and normally should be. "
-                   "The format of __PRETTY_FUNCTION__ (or __FUNCSIG__) was therefore (likely) changed since "
-                   "\"TypeNameImpl::Get()\"was written, so its implementation should be reviewed and corrected.");
+            }
+
+            return {ReplacementCodePoint, 1};
+        }
+        else
+        {
+            const char32_t codePoint = static_cast<char32_t>(str[i]);
+
+            return {codePoint <= 0x10FFFF ? codePoint : ReplacementCodePoint, 1};
+        }
+    }
+
+    template <typename CharT, typename OutputIt>
+    inline constexpr OutputIt EncodeCodePoint(const char32_t codePoint, OutputIt out) noexcept
+    {
+        if constexpr (sizeof(CharT) == 1)
+        {
+            if (codePoint < 0x80)
+            {
+                *out++ = static_cast<CharT>(codePoint);
+            }
+            else if (codePoint < 0x800)
+            {
+                *out++ = static_cast<CharT>(0xC0 | (codePoint >> 6));
+                *out++ = static_cast<CharT>(0x80 | (codePoint & 0x3F));
+            }
+            else if (codePoint < 0x10000)
+            {
+                *out++ = static_cast<CharT>(0xE0 | (codePoint >> 12));
+                *out++ = static_cast<CharT>(0x80 | ((codePoint >> 6) & 0x3F));
+                *out++ = static_cast<CharT>(0x80 | (codePoint & 0x3F));
+            }
+            else
+            {
+                *out++ = static_cast<CharT>(0xF0 | (codePoint >> 18));
+                *out++ = static_cast<CharT>(0x80 | ((codePoint >> 12) & 0x3F));
+                *out++ = static_cast<CharT>(0x80 | ((codePoint >> 6) & 0x3F));
+                *out++ = static_cast<CharT>(0x80 | (codePoint & 0x3F));
+            }
+        }
+        else if constexpr (sizeof(CharT) == 2)
+        {
+            if (codePoint < 0x10000)
+            {
+                *out++ = static_cast<CharT>(codePoint);
+            }
+            else
+            {
+                *out++ = static_cast<CharT>(0xD800 + ((codePoint - 0x10000) >> 10));
+                *out++ = static_cast<CharT>(0xDC00 + ((codePoint - 0x10000) & 0x3FF));
+            }
+        }
+        else
+        {
+            *out++ = static_cast<CharT>(codePoint);
+        }
+
+        return out;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    // Transcode(). Transcodes "str" to "ToCharT" characters (see
+    // comments above), writing them to "out" and returning the
+    // output iterator just past the last character written
+    ///////////////////////////////////////////////////////////////
+    template <typename ToCharT, typename FromCharT, typename OutputIt>
+    inline constexpr OutputIt Transcode(const std::basic_string_view<FromCharT> str, OutputIt out) noexcept
+    {
+        for (std::size_t i = 0; i < str.size();)
+        {
+            const DecodedCodePoint decoded = DecodeCodePoint(str, i);
+            out = EncodeCodePoint<ToCharT>(decoded.CodePoint, out);
+            i += decoded.Length;
+        }
+
+        return out;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    // CountingOutputIterator. Output iterator that only counts the
+    // characters written to it (used to determine the length of a
+    // string at compile time before writing it, such as a
+    // transcoded "TypeName_v" or a "SignatureName_v")
+    ///////////////////////////////////////////////////////////////
+    struct CountingOutputIterator
+    {
+        std::size_t Count = 0;
+
+        constexpr CountingOutputIterator &operator*() noexcept
+        {
+            return *this;
+        }
+
+        template <typename CharT>
+        constexpr CountingOutputIterator &operator=(CharT) noexcept
+        {
+            ++Count;
+            return *this;
+        }
+
+        constexpr CountingOutputIterator &operator++() noexcept
+        {
+            return *this;
+        }
+
+        constexpr CountingOutputIterator &operator++(int) noexcept
+        {
+            return *this;
+        }
+    };
+
+    template <typename T, typename CharT>
+    inline constexpr std::size_t TranscodedTypeNameLength = Transcode<CharT>(TypeNameImpl::Get<T>(), CountingOutputIterator{}).Count;
+
+    template <typename T, typename CharT>
+    inline constexpr FixedString<CharT, TranscodedTypeNameLength<T, CharT>> MakeTranscodedTypeName() noexcept
+    {
+        CharT buffer[TranscodedTypeNameLength<T, CharT> + 1] = {};
+        Transcode<CharT>(TypeNameImpl::Get<T>(), buffer);
+
+        return FixedString<CharT, TranscodedTypeNameLength<T, CharT>>(std::basic_string_view<CharT>(buffer, TranscodedTypeNameLength<T, CharT>));
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Static storage for "TypeName_v" declared just after this
+    // namespace when its "CharT" template arg isn't TCHAR (the
+    // name is then transcoded from "TypeNameImpl::Get<T>()" once
+    // at compile time and stored here). One instance exists per
+    // "T" and "CharT" for the entire program (since it's an inline
+    // variable).
+    ////////////////////////////////////////////////////////////////
+    template <typename T, typename CharT>
+    inline constexpr FixedString<CharT, TranscodedTypeNameLength<T, CharT>> TranscodedTypeNameStorage = MakeTranscodedTypeName<T, CharT>();
+
+    template <typename T, typename CharT>
+    inline constexpr std::basic_string_view<CharT> GetTypeName() noexcept
+    {
+        if constexpr (std::is_same_v<CharT, TCHAR>)
+        {
+            return TypeNameImpl::Get<T>();
+        }
+        else
+        {
+            return TranscodedTypeNameStorage<T, CharT>;
+        }
+    }
 } // namespace Private
+STDEXT_END_PRIVATE
 
 ////////////////////////////////////////////////////////////////////////
 // TypeName_v. Variable template that returns the literal name of the
@@ -694,6 +992,26 @@ namespace Private
 // always review the situation for other platforms in a future release
 // if ever required.
 //
+// If you need the name using some other character type however (such as
+// "char" in a Unicode build on MSFT platforms, or "wchar_t", "char8_t",
+// "char16_t" or "char32_t" anywhere), pass it as the optional 2nd
+// template arg "CharT" (which defaults to TCHAR). The name is then
+// extracted as usual (in TCHAR form) and transcoded to "CharT" once at
+// compile time (UTF-8, UTF-16 or UTF-32 based on the size of each
+// character type), and stored (null-terminated) in static storage, so no
+// conversion ever occurs at runtime (see "Private::Transcode()"). For
+// instance, "TypeName_v<float, wchar_t>" returns L"float" as a
+// "std::wstring_view" on all platforms.
+//
+// Note that when the compiler supports C++26 static reflection (see
+// REFLECTION_SUPPORTED in "CompilerVersions.h"), the name is retrieved
+// from the compiler directly ("std::meta::display_string_of()") instead
+// of being parsed out of __PRETTY_FUNCTION__ or __FUNCSIG__ as described
+// further below (unless STDEXT_NO_REFLECTION is #defined - see this for
+// details). The API is the same either way but the name's format is up
+// to the compiler, so it may differ from the one that __PRETTY_FUNCTION__
+// produces for the same type (for template types mostly).
+//
 //     EXAMPLE 1
 //     ---------
 //     ///////////////////////////////////////////////////////////
@@ -801,8 +1119,68 @@ namespace Private
 // goes wrong (again, via the the "static_asserts" in the private
 // implementation function called by this template).
 ///////////////////////////////////////////////////////////////////////////
+template <typename T, typename CharT = TCHAR>
+inline constexpr std::basic_string_view<CharT> TypeName_v = Private::GetTypeName<T, CharT>();
+
+///////////////////////////////////////////////////////////////////////////
+// Fnv1aHash(). Returns the 64-bit FNV-1a hash of "str" (each character is
+// hashed as a single unit so the hash of an (ASCII) string is the same
+// regardless of its character type). Normally used at compile time (via
+// "TypeHash_v" below for instance) but can also be called at runtime.
+///////////////////////////////////////////////////////////////////////////
+template <typename CharT>
+inline constexpr std::uint64_t Fnv1aHash(std::basic_string_view<CharT> str) noexcept
+{
+    std::uint64_t hash = 14695981039346656037ULL; // FNV offset basis
+
+    for (const CharT ch : str)
+    {
+        hash ^= static_cast<std::uint64_t>(static_cast<std::make_unsigned_t<CharT>>(ch));
+        hash *= 1099511628211ULL; // FNV prime
+    }
+
+    return hash;
+}
+
+STDEXT_BEGIN_PRIVATE
+{
+    ////////////////////////////////////////////////////////////////
+    // Static storage for "TypeNameFixed_v" declared just after this
+    // namespace (see this for details). One instance exists per
+    // type "T" for the entire program (since it's an inline variable).
+    ////////////////////////////////////////////////////////////////
+    template <typename T>
+    inline constexpr FixedString<TCHAR, TypeName_v<T>.size()> TypeNameFixedStorage = TypeName_v<T>;
+} // namespace Private
+STDEXT_END_PRIVATE
+
+///////////////////////////////////////////////////////////////////////////
+// TypeNameFixed_v. Same as "TypeName_v" above (it returns the identical
+// string) but the characters it refers to are stored in a static
+// "FixedString" created at compile time from "TypeName_v", instead of in
+// the (much longer) __PRETTY_FUNCTION__ (or for MSFT only, __FUNCSIG__)
+// string literal that "TypeName_v" refers to. The latter literal is
+// therefore only used during compilation so the compiler is free to
+// discard it, and only the name itself (null-terminated) is stored in
+// your program. Prefer this to "TypeName_v" when you need the name at
+// runtime (logging for instance), particularly for long (template)
+// types, in which case the savings can be significant.
+///////////////////////////////////////////////////////////////////////////
+template <typename T>
+inline constexpr tstring_view TypeNameFixed_v = Private::TypeNameFixedStorage<T>;
+
+///////////////////////////////////////////////////////////////////////////
+// TypeHash_v. 64-bit FNV-1a hash of "TypeName_v<T>" computed at compile
+// time (see "Fnv1aHash()" above). Can be used to key (runtime) maps by
+// type without comparing strings at runtime. Note that since the hash is
+// based on the name returned by "TypeName_v", which is compiler specific,
+// the hash for a given type may differ between compilers (but it's always
+// the same for a given compiler). Note that like any hash, different
+// types can (theoretically) collide though this is very unlikely in
+// practice for a 64-bit hash.
+///////////////////////////////////////////////////////////////////////////
 template <typename T>
-inline constexpr tstring_view TypeName_v = Private::TypeNameImpl::Get<T>();
+inline constexpr std::uint64_t TypeHash_v = Fnv1aHash(TypeName_v<T>);
 
 // See this #defined constant for details
 #if CONCEPTS_SUPPORTED
@@ -892,8 +1270,305 @@ template <typename T>
 using RemovePtrRef = std::remove_pointer_t<std::remove_reference_t<T>>;
 
 ///////////////////////////////////////////////////////////////////////////////
-// ReplaceNthType. Creates a type alias called "ReplaceNthType::Type" which is
-// a "std::tuple" of all types in the "Ts" template arg (parameter pack) but
+// For internal use only (by "NthType" just after this namespace)
+///////////////////////////////////////////////////////////////////////////////
+STDEXT_BEGIN_PRIVATE
+{
+    #if !PACK_INDEXING_SUPPORTED && !TYPE_PACK_ELEMENT_SUPPORTED
+        //////////////////////////////////////////////////////////////////
+        // "IndexedType" and "IndexedTypes". Used to implement "NthType"
+        // when neither C++26 pack indexing nor "__type_pack_element" are
+        // available. "IndexedTypes" inherits from "IndexedType<I, T>" once
+        // for every type "T" in "Ts" (where "I" is the zero-based index
+        // of "T" in "Ts"), so retrieving the "Ith" type is just a matter
+        // of letting overload resolution pick the (unique) base class
+        // whose index is "I" (via "SelectIndexedType()" below). All types
+        // are therefore created in a single (non-recursive) pack
+        // expansion, unlike "std::tuple_element" which is normally
+        // implemented recursively (so querying every type in a pack
+        // of "N" types costs "O(N^2)" instantiations there, but
+        // only "O(N)" here).
+        //////////////////////////////////////////////////////////////////
+        template <std::size_t I, typename T>
+        struct IndexedType
+        {
+            using Type = T;
+        };
+
+        template <typename IndexSequenceT, typename... Ts>
+        struct IndexedTypes;
+
+        template <std::size_t... Is, typename... Ts>
+        struct IndexedTypes<std::index_sequence<Is...>, Ts...> : IndexedType<Is, Ts>...
+        {
+        };
+
+        ///////////////////////////////////////////////////////
+        // Declared only (never defined since only called in
+        // an unevaluated context)
+        ///////////////////////////////////////////////////////
+        template <std::size_t I, typename T>
+        IndexedType<I, T> SelectIndexedType(const IndexedType<I, T> &);
+    #endif
+} // namespace Private
+STDEXT_END_PRIVATE
+
+///////////////////////////////////////////////////////////////////////////////
+// NthType. Creates a type alias called "NthType::Type" which is the "Nth"
+// type in the "Ts" template arg (parameter pack). Note that "N" must be less
+// than the number of types in "Ts" or a "static_assert" occurs. Equivalent
+// to "std::tuple_element_t<N, std::tuple<Ts...>>" but no "std::tuple" is
+// ever instantiated, and the lookup itself has constant (not linear)
+// instantiation depth. C++26 pack indexing ("Ts...[N]") is used when
+// available, then the "__type_pack_element" compiler intrinsic, and a
+// single pack expansion over "std::index_sequence" otherwise (see
+// "Private::IndexedTypes" above).
+//
+//     Example
+//     -------
+//     // Retrieve the "char" in the following parameter pack (index 2)
+//     using CharType = NthType_t<2, float, double, char, std::string>;
+//
+//     static_assert(std::is_same_v<CharType, char>);
+///////////////////////////////////////////////////////////////////////////////
+template <std::size_t N,
+          typename... Ts>
+struct NthType
+{
+private:
+    // See comments above
+    static_assert(N < sizeof...(Ts), "Template arg \"N\" must be less than the number of types in template "
+                                     "arg (parameter pack) \"Ts\"");
+
+public:
+    #if PACK_INDEXING_SUPPORTED
+        using Type = Ts...[N];
+    #elif TYPE_PACK_ELEMENT_SUPPORTED
+        using Type = __type_pack_element<N, Ts...>;
+    #else
+        using Type = typename decltype(Private::SelectIndexedType<N>(std::declval<Private::IndexedTypes<std::index_sequence_for<Ts...>, Ts...>>()))::Type;
+    #endif
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// NthType_t. Helper alias for "NthType::Type" just above. See "NthType"
+// comments above.
+//////////////////////////////////////////////////////////////////////////////
+template <std::size_t N,
+          typename... Ts>
+using NthType_t = typename NthType<N, Ts...>::Type;
+
+///////////////////////////////////////////////////////////////////////////////
+// For internal use only (by "TupleElement", "TypeList" and "FunctionTraits"
+// further below)
+///////////////////////////////////////////////////////////////////////////////
+STDEXT_BEGIN_PRIVATE
+{
+    ////////////////////////////////////////////////////////////////////////
+    // PackIndexer. Same as "NthType" but for looking up many (usually all)
+    // types in the same pack "Ts", one index at a time ("TypeList::Type",
+    // "TupleElement" and "FunctionTraits::Args", so "ForEachTupleType()",
+    // "ForEachArg()", "ArgType_t", etc.). The pack is only expanded (and
+    // "Private::IndexedTypes" only created) once per pack, when
+    // "PackIndexer" itself is instantiated, and each "At<I>" then
+    // performs a single lookup into it. Looking up each index via
+    // "NthType_t<I, Ts...>" instead re-expands all of "Ts" for every "I"
+    // (and in "TupleElement", deduces "Ts" from the "std::tuple" for every
+    // "I" as well), so looking up all "N" types in a pack costs "N" times
+    // more (in practice GCC 12 takes minutes to iterate a "std::tuple" of
+    // 4000 types that way, vs seconds using "PackIndexer").
+    ////////////////////////////////////////////////////////////////////////
+    template <typename... Ts>
+    struct PackIndexer
+    {
+        #if !PACK_INDEXING_SUPPORTED && !TYPE_PACK_ELEMENT_SUPPORTED
+            using Types = IndexedTypes<std::index_sequence_for<Ts...>, Ts...>;
+        #endif
+
+        template <std::size_t I>
+        struct At
+        {
+            // See comments preceding "NthType"
+            static_assert(I < sizeof...(Ts), "Template arg \"I\" must be less than the number of types in template "
+                                             "arg (parameter pack) \"Ts\"");
+
+            #if PACK_INDEXING_SUPPORTED
+                using Type = Ts...[I];
+            #elif TYPE_PACK_ELEMENT_SUPPORTED
+                using Type = __type_pack_element<I, Ts...>;
+            #else
+                using Type = typename decltype(Private::SelectIndexedType<I>(std::declval<const Types &>()))::Type;
+            #endif
+        };
+    };
+
+    ////////////////////////////////////////////////////////////////////////
+    // TupleIndexer. Implements "TupleElement" just after this namespace.
+    // The primary template defers to "std::tuple_element" for all
+    // (tuple-like) types that aren't a "std::tuple", while the partial
+    // specialization just below defers to "PackIndexer" above for
+    // "std::tuple" itself (so "Ts" is deduced from "TupleT" just once
+    // per tuple, not once per index).
+    ////////////////////////////////////////////////////////////////////////
+    template <typename TupleT>
+    struct TupleIndexer
+    {
+        template <std::size_t I>
+        struct At
+        {
+            using Type = std::tuple_element_t<I, TupleT>;
+        };
+    };
+
+    template <typename... Ts>
+    struct TupleIndexer<std::tuple<Ts...>> : PackIndexer<Ts...>
+    {
+    };
+} // namespace Private
+STDEXT_END_PRIVATE
+
+//////////////////////////////////////////////////////////////////////////////
+// TupleElement. Same as "std::tuple_element" but when "TupleT" is a
+// "std::tuple" (the usual case), defers to "Private::PackIndexer" instead
+// (avoiding the recursive instantiations most implementations of
+// "std::tuple_element" incur, and deducing the tuple's types just once no
+// matter how many of its elements are looked up). Simply defers to
+// "std::tuple_element" for all other (tuple-like) types.
+//////////////////////////////////////////////////////////////////////////////
+template <std::size_t I,
+          typename TupleT>
+struct TupleElement
+{
+    using Type = typename Private::TupleIndexer<TupleT>::template At<I>::Type;
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// TupleElement_t. Helper alias for "TupleElement::Type" just above. See
+// "TupleElement" comments above.
+//////////////////////////////////////////////////////////////////////////////
+template <std::size_t I,
+          typename TupleT>
+using TupleElement_t = typename TupleElement<I, TupleT>::Type;
+
+//////////////////////////////////////////////////////////////////////////////
+// TypeList. Lightweight alternative to "std::tuple" for storing a list of
+// types (parameter pack) when the types are never actually used to store
+// any values (the usual case when dealing with function argument types for
+// instance). Unlike "std::tuple", which is one of the most expensive class
+// templates to instantiate in the standard library (it has many members,
+// base classes and constructors), "TypeList" is an empty class with no
+// base classes, so instantiating it is very cheap. It's used by
+// "FunctionTraits" to expose the function's argument types via its
+// "ArgTypeList" member (and the "ArgTypeList_t" helper template - see
+// these for details), and internally by the "ReplaceNthArg" family of
+// write traits (no "std::tuple" is instantiated by these). Should you
+// require a "std::tuple" however then simply access the "Tuple" alias
+// below (though "FunctionTraits::ArgTypes" and the "ArgTypes_t" helper
+// template are already a "std::tuple" - alias "Tuple" below simply
+// yields the same type).
+//////////////////////////////////////////////////////////////////////////////
+template <typename... Ts>
+struct TypeList
+{
+    // Number of types in "Ts"
+    static constexpr std::size_t Size = sizeof...(Ts);
+
+    // Zero-based "Ith" type in "Ts" (see "NthType" and
+    // "Private::PackIndexer" for details)
+    template <std::size_t I>
+    using Type = typename Private::PackIndexer<Ts...>::template At<I>::Type;
+
+    // "std::tuple" storing the types in "Ts"
+    using Tuple = std::tuple<Ts...>;
+};
+
+///////////////////////////////////////////////////////
+// IsTypeList. Inherits from "std::true_type" if "T"
+// is a "TypeList" specialization or "std::false_type"
+// otherwise (and helper variable template "IsTypeList_v"
+// just after).
+///////////////////////////////////////////////////////
+template <typename T>
+struct IsTypeList : std::bool_constant<IsSpecialization_v<T, TypeList>>
+{
+};
+
+template <typename T>
+inline constexpr bool IsTypeList_v = IsTypeList<T>::value;
+
+//////////////////////////////////////////////
+// Concept for above template (see following
+// #defined constant for details)
+//////////////////////////////////////////////
+#if CONCEPTS_SUPPORTED
+    template <typename T>
+    concept TypeList_c = IsTypeList_v<T>;
+
+    #define TYPE_LIST_C StdExt::TypeList_c
+#else
+    #define STATIC_ASSERT_IS_TYPE_LIST(T) static_assert(StdExt::IsTypeList<T>::value, \
+                                                        "\"" #T "\" must be a \"TypeList\"");
+    #define TYPE_LIST_C typename
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// For internal use only (by "ReplaceNthType" and "ReplaceNthTypeList" just
+// after this namespace)
+///////////////////////////////////////////////////////////////////////////////
+STDEXT_BEGIN_PRIVATE
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // SelectType. "SelectType<true>::Type<NewT, T>" is "NewT" and
+    // "SelectType<false>::Type<NewT, T>" is "T". Same as
+    // "std::conditional_t<B, NewT, T>" but no class is ever instantiated
+    // for each "NewT" and "T" (there are just the two specializations of
+    // "SelectType" itself), which matters when it's expanded over every
+    // type in a large pack (as "ReplaceNthTypeImpl" just below does).
+    ///////////////////////////////////////////////////////////////////////////
+    template <bool B>
+    struct SelectType
+    {
+        template <typename NewT, typename T>
+        using Type = T;
+    };
+
+    template <>
+    struct SelectType<true>
+    {
+        template <typename NewT, typename T>
+        using Type = NewT;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // ReplaceNthTypeImpl. Implements "ReplaceNthType" and "ReplaceNthTypeList"
+    // declared just after this namespace, where "ListT" is the template
+    // that the resulting types are stored in ("std::tuple" for the former
+    // or "TypeList" for the latter). See these for details.
+    ///////////////////////////////////////////////////////////////////////////
+    template <template<typename...> class ListT,
+              std::size_t N,
+              typename NewT,
+              typename... Ts>
+    struct ReplaceNthTypeImpl
+    {
+    private:
+        // See comments preceding "ReplaceNthType"
+        static_assert(N < sizeof...(Ts), "Template arg \"N\" must be less than the number of types in template "
+                                         "arg (parameter pack) \"Ts\" (i.e., \"N\" must target an existing type "
+                                         "in \"Ts\" to be replaced - new types can't be added using this alias)");
+
+        template <std::size_t... Ints>
+        static auto ReplaceNth(std::index_sequence<Ints...>) -> ListT<typename SelectType<Ints == N>::template Type<NewT, Ts>...>;
+
+    public:
+        using Type = decltype(ReplaceNth(std::index_sequence_for<Ts...>()));
+    };
+} // namespace Private
+STDEXT_END_PRIVATE
+
+///////////////////////////////////////////////////////////////////////////////
+// ReplaceNthType. Creates a type alias called "ReplaceNthType::Type" which is
+// a "std::tuple" of all types in the "Ts" template arg (parameter pack) but
 // where the "Nth" type in "Ts" has been replaced with "NewT". The purpose is
 // therefore to simply replace the "Nth" type in a parameter pack with a new
 // type and create an alias for the resulting parameter pack as a "std::tuple"
@@ -932,17 +1607,7 @@ template <std::size_t N,
           typename... Ts>
 struct ReplaceNthType
 {
-private:
-    // See comments above
-    static_assert(N < sizeof...(Ts), "Template arg \"N\" must be less than the number of types in template "
-                                     "arg (parameter pack) \"Ts\" (i.e., \"N\" must target an existing type "
-                                     "in \"Ts\" to be replaced - new types can't be added using this alias)");
-
-    template <std::size_t... Ints>
-    static auto ReplaceNth(std::index_sequence<Ints...>) -> std::tuple<std::conditional_t<Ints == N, NewT, Ts>...>;
-
-public:
-    using Type = decltype(ReplaceNth(std::index_sequence_for<Ts...>()));
+    using Type = typename Private::ReplaceNthTypeImpl<std::tuple, N, NewT, Ts...>::Type;
 };
 
 //////////////////////////////////////////////////////////////////////////////
@@ -954,6 +1619,28 @@ template <std::size_t N,
           typename... Ts>
 using ReplaceNthType_t = typename ReplaceNthType<N, NewT, Ts...>::Type;
 
+//////////////////////////////////////////////////////////////////////////////
+// ReplaceNthTypeList. Identical to "ReplaceNthType" above but the resulting
+// types are stored in a "TypeList" instead of a "std::tuple" (so cheaper to
+// instantiate). See "ReplaceNthType" and "TypeList" for details.
+//////////////////////////////////////////////////////////////////////////////
+template <std::size_t N,
+          typename NewT,
+          typename... Ts>
+struct ReplaceNthTypeList
+{
+    using Type = typename Private::ReplaceNthTypeImpl<TypeList, N, NewT, Ts...>::Type;
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// ReplaceNthTypeList_t. Helper alias for "ReplaceNthTypeList::Type" just
+// above. See "ReplaceNthTypeList" comments above.
+//////////////////////////////////////////////////////////////////////////////
+template <std::size_t N,
+          typename NewT,
+          typename... Ts>
+using ReplaceNthTypeList_t = typename ReplaceNthTypeList<N, NewT, Ts...>::Type;
+
 //////////////////////////////////////////////////////////////
 // "IsTuple" (primary template). Determines if "T" is a
 // "std::tuple" specialization. Note that the primary template
@@ -1172,7 +1859,7 @@ inline constexpr bool IsTuple_v = IsTuple<T>::value;
 ///////////////////////////////////////////////////////////////////////////
 
 // For internal use only ...
-namespace Private
+STDEXT_BEGIN_PRIVATE
 {
     /////////////////////////////////////////////////////////////////////
     // "IsFreeFunction" (primary template). Primary template inherits
@@ -1522,6 +2209,56 @@ namespace Private
     template <typename T>
     inline constexpr bool IsFunctor_v = IsFunctor<T>::value;
 
+    ///////////////////////////////////////////////////////////////////
+    // FunctionKind. What "ClassifyFunction_v" just below classifies a
+    // type as (see this for details)
+    ///////////////////////////////////////////////////////////////////
+    enum class FunctionKind
+    {
+        None,           // Not a function suitable for "FunctionTraits"
+        FreeFunction,   // Free function, pointer or reference to one, or reference to pointer to one
+        MemberFunction, // Pointer to a non-static member function or reference to one
+        Functor         // Functor or reference to one
+    };
+
+    ///////////////////////////////////////////////////////////////////
+    // ClassifyFunction_v. Classifies "T" once and for all for the
+    // purposes of "FunctionTraits", i.e., whether it's a free function
+    // (or a pointer or reference to one, or a reference to a pointer
+    // to one), a pointer to a non-static member function (or a
+    // reference to one), a functor (or a reference to one), or none of
+    // these. Every such query in this file (the "IsTraits*_v"
+    // templates below, the concepts based on them such as
+    // TRAITS_FUNCTION_C, and the partial specializations of
+    // "FunctionTraits" itself) reads the result from here, so for any
+    // given "T" the work is done in a single instantiation no matter
+    // how many times (or by how many templates) it's queried. Note
+    // that the (SFINAE-based) "IsFunctor" probe is only instantiated
+    // (by the partial specialization just below) if "T" is a class (or
+    // union) once any reference and cv-qualifiers are removed, so it's
+    // never instantiated for function types, pointers to them or
+    // non-class types, and it's always instantiated for the class
+    // itself (so it's shared by all variants of the same functor type,
+    // i.e., "F", "const F &", etc.). Conversely, the free and member
+    // function checks are never instantiated for classes.
+    ///////////////////////////////////////////////////////////////////
+    template <typename T,
+              typename ClassT = RemoveCvRef<T>,
+              bool IsClassT = std::is_class_v<ClassT> || std::is_union_v<ClassT>>
+    inline constexpr FunctionKind ClassifyFunction_v = IsFreeFunction_v<RemovePtrRef<T>> ? FunctionKind::FreeFunction :
+                                                       std::is_member_function_pointer_v<std::remove_reference_t<T>> ? FunctionKind::MemberFunction :
+                                                                                                                       FunctionKind::None;
+
+    ///////////////////////////////////////////////////////////////////
+    // Partial specialization of "ClassifyFunction_v" just above for
+    // classes (and unions) and references to them, which can only be
+    // functors (so only the "IsFunctor" probe is required)
+    ///////////////////////////////////////////////////////////////////
+    template <typename T,
+              typename ClassT>
+    inline constexpr FunctionKind ClassifyFunction_v<T, ClassT, true> = IsFunctor_v<ClassT> ? FunctionKind::Functor :
+                                                                                              FunctionKind::None;
+
     /////////////////////////////////////////////////////////////////
     // IsTraitsFreeFunction_v. Variable template set to true if "T"
     // is any of the following or false otherwise:
@@ -1534,7 +2271,7 @@ namespace Private
     //   4) A reference to a pointer to a free function
     /////////////////////////////////////////////////////////////////
     template <typename T>
-    inline constexpr bool IsTraitsFreeFunction_v = IsFreeFunction_v<RemovePtrRef<T>>;
+    inline constexpr bool IsTraitsFreeFunction_v = (ClassifyFunction_v<T> == FunctionKind::FreeFunction);
 
     //////////////////////////////////////////////
     // Concept for above template (see following
@@ -1557,7 +2294,7 @@ namespace Private
     //   2) A reference to a pointer to a non-static member function
     ///////////////////////////////////////////////////////////////////
     template <typename T>
-    inline constexpr bool IsTraitsMemberFunction_v = std::is_member_function_pointer_v<std::remove_reference_t<T>>;
+    inline constexpr bool IsTraitsMemberFunction_v = (ClassifyFunction_v<T> == FunctionKind::MemberFunction);
 
     //////////////////////////////////////////////
     // Concept for above template (see following
@@ -1589,8 +2326,8 @@ namespace Private
     // https://www.open-std.org/jtc1/sc22/wg21/docs/papers/2015/p0172r0.html
     ///////////////////////////////////////////////////////////////////
     template <typename T>
-    inline constexpr bool IsTraitsFreeOrMemberFunction_v = IsTraitsFreeFunction_v<T> ||
-                                                           IsTraitsMemberFunction_v<T>;
+    inline constexpr bool IsTraitsFreeOrMemberFunction_v = (ClassifyFunction_v<T> == FunctionKind::FreeFunction) ||
+                                                           (ClassifyFunction_v<T> == FunctionKind::MemberFunction);
 
     //////////////////////////////////////////////
     // Concept for above template (see following
@@ -1605,9 +2342,17 @@ namespace Private
         #define TRAITS_FREE_OR_MEMBER_FUNCTION_C typename
     #endif
 
-    // Usual "_v" helper variable for above template
+    //////////////////////////////////////////////////////////
+    // Usual "_v" helper variable for above template. Note
+    // that cv-qualifiers are removed as well as any reference
+    // so the (SFINAE-based) "IsFunctor" probe is instantiated
+    // just once for all variants of the same functor type
+    // ("F", "const F &", etc.), just like "FunctorTraits"
+    // itself (see the "FunctionTraits" specialization for
+    // functors, and "ClassifyFunction_v" above)
+    //////////////////////////////////////////////////////////
     template <typename T>
-    inline constexpr bool IsTraitsFunctor_v = IsFunctor_v<std::remove_reference_t<T>>;
+    inline constexpr bool IsTraitsFunctor_v = (ClassifyFunction_v<T> == FunctionKind::Functor);
 
     //////////////////////////////////////////////
     // Concept for above template (see following
@@ -1622,6 +2367,7 @@ namespace Private
         #define TRAITS_FUNCTOR_C typename
     #endif
 } // namespace Private
+STDEXT_END_PRIVATE
 
 /////////////////////////////////////////////////////////////////////////////
 // "IsTraitsFunction_v". Variable_template set to true if "T" is a function
@@ -1731,7 +2477,7 @@ inline constexpr bool IsTraitsFunction_v = Private::IsTraitsFreeFunction_v<T> ||
 //////////////////////////////////////////////
 #if CONCEPTS_SUPPORTED
     template <typename T>
-    concept TraitsFunction_c = IsTraitsFunction_v<T>;
+    concept TraitsFunction_c = (Private::ClassifyFunction_v<T> != Private::FunctionKind::None); // Same as "IsTraitsFunction_v<T>"
 
     #define TRAITS_FUNCTION_C StdExt::TraitsFunction_c
 #else
@@ -1899,6 +2645,77 @@ inline constexpr bool IsTraitsFunction_v = Private::IsTraitsFreeFunction_v<T> ||
 ///////////////////////////////////////////////////////////////////
 #define STDEXT_CC_VARIADIC STDEXT_CC_CDECL
 
+/////////////////////////////////////////////////////////////////////////////
+// STDEXT_CC_PRUNE and STDEXT_CC_ONLY_CDECL. Opt-in #defined constants you
+// can #define before #including this header to reduce the number of
+// "FunctionTraits" partial specializations it creates (it normally creates
+// them for every calling convention above, for every permutation of
+// noexcept, and for non-static member functions, every permutation of
+// const, volatile and & or &&, even when the compiler replaces the calling
+// convention with STDEXT_CC_CDECL, i.e., ignores it). Fewer
+// specializations means fewer candidates the compiler must consider
+// whenever it matches "FunctionTraits<F>" to the right specialization,
+// which can noticeably shorten compile times in large codebases.
+//
+// If STDEXT_CC_PRUNE is #defined then specializations are only created for
+// calling conventions known to be distinct from STDEXT_CC_CDECL on the
+// target platform, based on the compiler and architecture (for instance
+// only cdecl and (except for GCC) vectorcall on x86-64, since stdcall,
+// fastcall and thiscall are all replaced with cdecl there). It's safe to
+// #define normally since this is only done for the platforms seen below,
+// and each calling convention skipped is verified by a "static_assert"
+// (see "CallingConventionReplacedWithCdecl()") so if the compiler doesn't
+// actually replace it with cdecl, compilation fails instead of
+// "FunctionTraits" silently not supporting it. Functions declared with
+// the skipped calling conventions are still fully supported since the
+// compiler itself changes them to cdecl.
+//
+// If STDEXT_CC_ONLY_CDECL is #defined then specializations are created for
+// STDEXT_CC_CDECL only (which is also the calling convention of all
+// variadic functions), so all other calling conventions are no longer
+// supported by "FunctionTraits" on platforms where they're distinct from
+// cdecl. Don't #define it unless your code only ever passes cdecl
+// functions to "FunctionTraits" (note that non-static member functions are
+// normally "thiscall" by default on 32 bit MSFT platforms, not cdecl).
+//
+// The following #defined constants (for internal use only) are then set to
+// 1 if specializations are to be created for the given calling convention
+// or 0 otherwise (STDEXT_CC_CDECL is always 1 so isn't included).
+/////////////////////////////////////////////////////////////////////////////
+#if defined(STDEXT_CC_ONLY_CDECL)
+    #define STDEXT_CC_STDCALL_SPECIALIZED 0
+    #define STDEXT_CC_FASTCALL_SPECIALIZED 0
+    #define STDEXT_CC_VECTORCALL_SPECIALIZED 0
+    #define STDEXT_CC_THISCALL_SPECIALIZED 0
+    #define STDEXT_CC_REGCALL_SPECIALIZED 0
+#elif defined(STDEXT_CC_PRUNE) && \
+      ((defined(_MSC_VER) && defined(_M_X64) && !defined(_M_ARM64EC)) || \
+       ((defined(__clang__) || defined(__INTEL_COMPILER)) && defined(__x86_64__)))
+    #define STDEXT_CC_STDCALL_SPECIALIZED 0
+    #define STDEXT_CC_FASTCALL_SPECIALIZED 0
+    #define STDEXT_CC_VECTORCALL_SPECIALIZED 1
+    #define STDEXT_CC_THISCALL_SPECIALIZED 0
+    #define STDEXT_CC_REGCALL_SPECIALIZED 1
+#elif defined(STDEXT_CC_PRUNE) && defined(GCC) && (defined(__x86_64__) || defined(__aarch64__))
+    #define STDEXT_CC_STDCALL_SPECIALIZED 0
+    #define STDEXT_CC_FASTCALL_SPECIALIZED 0
+    #define STDEXT_CC_VECTORCALL_SPECIALIZED 0
+    #define STDEXT_CC_THISCALL_SPECIALIZED 0
+    #define STDEXT_CC_REGCALL_SPECIALIZED 0
+#elif defined(STDEXT_CC_PRUNE) && defined(GCC) && defined(__i386__)
+    #define STDEXT_CC_STDCALL_SPECIALIZED 1
+    #define STDEXT_CC_FASTCALL_SPECIALIZED 1
+    #define STDEXT_CC_VECTORCALL_SPECIALIZED 0 // Not supported by GCC
+    #define STDEXT_CC_THISCALL_SPECIALIZED 1
+    #define STDEXT_CC_REGCALL_SPECIALIZED 0
+#else
+    #define STDEXT_CC_STDCALL_SPECIALIZED 1
+    #define STDEXT_CC_FASTCALL_SPECIALIZED 1
+    #define STDEXT_CC_VECTORCALL_SPECIALIZED 1
+    #define STDEXT_CC_THISCALL_SPECIALIZED 1
+    #define STDEXT_CC_REGCALL_SPECIALIZED 1
+#endif
+
 enum class CallingConvention
 {
     /////////////////////////////////////////////////////////
@@ -2120,8 +2937,258 @@ inline constexpr tstring_view RefQualifierToString(const RefQualifier refQualifi
 }
 
 // For internal use only
-namespace Private
+STDEXT_BEGIN_PRIVATE
 {
+    ///////////////////////////////////////////////////////////////////////
+    // FreeFunctionTypeBuilder (primary template). Builds the type of a
+    // free function (including static member functions) from its
+    // individual components, via the "Type" alias template in the
+    // explicit specializations just below (one for each calling
+    // convention, which "CallingConventionT" identifies, plus one for
+    // variadic functions, which "IsVariadicT" identifies, and whose
+    // calling convention must always be "CallingConvention::Variadic" in
+    // this release - see STDEXT_CC_VARIADIC). The primary template is
+    // never used (it's not defined). Note that since these are explicit
+    // specializations, selecting the applicable one is just a lookup (no
+    // partial specialization matching is involved), and the result is
+    // correct even when the compiler replaces the given calling
+    // convention with STDEXT_CC_CDECL (since the resulting type is then
+    // just a cdecl function, exactly as if declared by hand).
+    ///////////////////////////////////////////////////////////////////////
+    template <CallingConvention CallingConventionT,
+              bool IsVariadicT>
+    struct FreeFunctionTypeBuilder;
+
+    /////////////////////////////////////////////////////////////
+    // Explicit specialization of "FreeFunctionTypeBuilder" just
+    // above for the given calling convention (macro for internal
+    // use only - #undefined just after we're done with it)
+    /////////////////////////////////////////////////////////////
+    #define MAKE_FREE_FUNCTION_TYPE_BUILDER(CC, CALLING_CONVENTION, IS_VARIADIC, ARGS) \
+        template <> \
+        struct FreeFunctionTypeBuilder<CALLING_CONVENTION, IS_VARIADIC> \
+        { \
+            template <typename R, \
+                      class, /* Always void (for consistency with "MemberFunctionTypeBuilder") */ \
+                      bool IsNoexceptT, \
+                      typename... ArgsT> \
+            using Type = R CC ARGS noexcept(IsNoexceptT); \
+        };
+
+    MAKE_FREE_FUNCTION_TYPE_BUILDER(STDEXT_CC_CDECL,      CallingConvention::Cdecl,      false, (ArgsT...))
+    MAKE_FREE_FUNCTION_TYPE_BUILDER(STDEXT_CC_STDCALL,    CallingConvention::Stdcall,    false, (ArgsT...))
+    MAKE_FREE_FUNCTION_TYPE_BUILDER(STDEXT_CC_FASTCALL,   CallingConvention::Fastcall,   false, (ArgsT...))
+    MAKE_FREE_FUNCTION_TYPE_BUILDER(STDEXT_CC_VECTORCALL, CallingConvention::Vectorcall, false, (ArgsT...))
+    #ifdef STDEXT_CC_REGCALL
+        MAKE_FREE_FUNCTION_TYPE_BUILDER(STDEXT_CC_REGCALL, CallingConvention::Regcall,   false, (ArgsT...))
+    #endif
+    MAKE_FREE_FUNCTION_TYPE_BUILDER(STDEXT_CC_VARIADIC,   CallingConvention::Variadic,   true,  (ArgsT..., ...))
+
+    #undef MAKE_FREE_FUNCTION_TYPE_BUILDER // Done with this
+
+    ///////////////////////////////////////////////////////////////////////
+    // MemberFunctionTypeBuilder (primary template). Same as
+    // "FreeFunctionTypeBuilder" just above but builds the type of a
+    // pointer to a non-static member function instead, so also keyed on
+    // the function's cv-qualifiers and ref-qualifier (one explicit
+    // specialization exists for each permutation of these for each
+    // calling convention, plus those for variadic functions). The
+    // primary template is never used (it's not defined).
+    ///////////////////////////////////////////////////////////////////////
+    template <CallingConvention CallingConventionT,
+              bool IsVariadicT,
+              bool IsConstT,
+              bool IsVolatileT,
+              RefQualifier RefQualifierT>
+    struct MemberFunctionTypeBuilder;
+
+    /////////////////////////////////////////////////////////////////
+    // Explicit specializations of "MemberFunctionTypeBuilder" just
+    // above (macros for internal use only - #undefined just after
+    // we're done with them). Each macro launches the one before it
+    // once for each permutation of its own qualifier (starting with
+    // MAKE_MEMBER_FUNCTION_TYPE_BUILDER, the one callers invoke).
+    /////////////////////////////////////////////////////////////////
+    #define MAKE_MEMBER_FUNCTION_TYPE_BUILDER_3(CC, CALLING_CONVENTION, IS_VARIADIC, ARGS, CONST, IS_CONST, VOLATILE, IS_VOLATILE, REF, REF_QUALIFIER) \
+        template <> \
+        struct MemberFunctionTypeBuilder<CALLING_CONVENTION, IS_VARIADIC, IS_CONST, IS_VOLATILE, REF_QUALIFIER> \
+        { \
+            template <typename R, \
+                      class C, \
+                      bool IsNoexceptT, \
+                      typename... ArgsT> \
+            using Type = R (CC C::*)ARGS CONST VOLATILE REF noexcept(IsNoexceptT); \
+        };
+
+    // & and && (macro for internal use only - invokes macro just above)
+    #define MAKE_MEMBER_FUNCTION_TYPE_BUILDER_2(CC, CALLING_CONVENTION, IS_VARIADIC, ARGS, CONST, IS_CONST, VOLATILE, IS_VOLATILE) \
+        MAKE_MEMBER_FUNCTION_TYPE_BUILDER_3(CC, CALLING_CONVENTION, IS_VARIADIC, ARGS, CONST, IS_CONST, VOLATILE, IS_VOLATILE,   , RefQualifier::None) \
+        MAKE_MEMBER_FUNCTION_TYPE_BUILDER_3(CC, CALLING_CONVENTION, IS_VARIADIC, ARGS, CONST, IS_CONST, VOLATILE, IS_VOLATILE,  &, RefQualifier::LValue) \
+        MAKE_MEMBER_FUNCTION_TYPE_BUILDER_3(CC, CALLING_CONVENTION, IS_VARIADIC, ARGS, CONST, IS_CONST, VOLATILE, IS_VOLATILE, &&, RefQualifier::RValue)
+
+    // volatile (macro for internal use only - invokes macro just above)
+    #define MAKE_MEMBER_FUNCTION_TYPE_BUILDER_1(CC, CALLING_CONVENTION, IS_VARIADIC, ARGS, CONST, IS_CONST) \
+        MAKE_MEMBER_FUNCTION_TYPE_BUILDER_2(CC, CALLING_CONVENTION, IS_VARIADIC, ARGS, CONST, IS_CONST,         , false) \
+        MAKE_MEMBER_FUNCTION_TYPE_BUILDER_2(CC, CALLING_CONVENTION, IS_VARIADIC, ARGS, CONST, IS_CONST, volatile, true)
+
+    // const (macro for internal use only - invokes macro just above)
+    #define MAKE_MEMBER_FUNCTION_TYPE_BUILDER(CC, CALLING_CONVENTION, IS_VARIADIC, ARGS) \
+        MAKE_MEMBER_FUNCTION_TYPE_BUILDER_1(CC, CALLING_CONVENTION, IS_VARIADIC, ARGS,      , false) \
+        MAKE_MEMBER_FUNCTION_TYPE_BUILDER_1(CC, CALLING_CONVENTION, IS_VARIADIC, ARGS, const, true)
+
+    MAKE_MEMBER_FUNCTION_TYPE_BUILDER(STDEXT_CC_CDECL,      CallingConvention::Cdecl,      false, (ArgsT...))
+    MAKE_MEMBER_FUNCTION_TYPE_BUILDER(STDEXT_CC_STDCALL,    CallingConvention::Stdcall,    false, (ArgsT...))
+    MAKE_MEMBER_FUNCTION_TYPE_BUILDER(STDEXT_CC_FASTCALL,   CallingConvention::Fastcall,   false, (ArgsT...))
+    MAKE_MEMBER_FUNCTION_TYPE_BUILDER(STDEXT_CC_VECTORCALL, CallingConvention::Vectorcall, false, (ArgsT...))
+    MAKE_MEMBER_FUNCTION_TYPE_BUILDER(STDEXT_CC_THISCALL,   CallingConvention::Thiscall,   false, (ArgsT...))
+    #ifdef STDEXT_CC_REGCALL
+        MAKE_MEMBER_FUNCTION_TYPE_BUILDER(STDEXT_CC_REGCALL, CallingConvention::Regcall,   false, (ArgsT...))
+    #endif
+    MAKE_MEMBER_FUNCTION_TYPE_BUILDER(STDEXT_CC_VARIADIC,   CallingConvention::Variadic,   true,  (ArgsT..., ...))
+
+    // Done with these
+    #undef MAKE_MEMBER_FUNCTION_TYPE_BUILDER
+    #undef MAKE_MEMBER_FUNCTION_TYPE_BUILDER_1
+    #undef MAKE_MEMBER_FUNCTION_TYPE_BUILDER_2
+    #undef MAKE_MEMBER_FUNCTION_TYPE_BUILDER_3
+
+    ///////////////////////////////////////////////////////////////////////
+    // BuildFunctionType. Builds the type of a free function (if
+    // "ClassT" is "void", in which case "IsConstT", "IsVolatileT" and
+    // "RefQualifierT" are ignored) or a pointer to a non-static member
+    // function of class "ClassT" otherwise, from the given components
+    // (via "FreeFunctionTypeBuilder" or "MemberFunctionTypeBuilder"
+    // above). "ArgsT" is a "TypeList" of the function's (non-variadic)
+    // arg types. If "IsVariadicT" is true then "CallingConventionT" is
+    // ignored (variadic functions are always STDEXT_CC_VARIADIC), as is
+    // "CallingConvention::Thiscall" for free functions (not supported by
+    // free functions so "CallingConvention::Cdecl" is used instead).
+    // Never instantiates "FunctionTraits" or any "std::tuple". See
+    // "BuildFunctionType_t" just below for the resulting "Type".
+    ///////////////////////////////////////////////////////////////////////
+    template <typename ReturnTypeT,
+              typename ClassT,
+              CallingConvention CallingConventionT,
+              bool IsVariadicT,
+              bool IsConstT,
+              bool IsVolatileT,
+              RefQualifier RefQualifierT,
+              bool IsNoexceptT,
+              typename ArgsT>
+    struct BuildFunctionType;
+
+    template <typename ReturnTypeT,
+              typename ClassT,
+              CallingConvention CallingConventionT,
+              bool IsVariadicT,
+              bool IsConstT,
+              bool IsVolatileT,
+              RefQualifier RefQualifierT,
+              bool IsNoexceptT,
+              typename... ArgsT>
+    struct BuildFunctionType<ReturnTypeT, ClassT, CallingConventionT, IsVariadicT, IsConstT, IsVolatileT, RefQualifierT, IsNoexceptT, TypeList<ArgsT...>>
+    {
+        static constexpr CallingConvention BuildCallingConvention = IsVariadicT ? CallingConvention::Variadic :
+                                                                    std::is_void_v<ClassT> && CallingConventionT == CallingConvention::Thiscall ? CallingConvention::Cdecl :
+                                                                    CallingConventionT;
+
+        using Type = typename std::conditional_t<std::is_void_v<ClassT>,
+                                                 FreeFunctionTypeBuilder<BuildCallingConvention, IsVariadicT>,
+                                                 MemberFunctionTypeBuilder<BuildCallingConvention, IsVariadicT, IsConstT, IsVolatileT, RefQualifierT>>::template Type<ReturnTypeT, ClassT, IsNoexceptT, ArgsT...>;
+    };
+
+    template <typename ReturnTypeT,
+              typename ClassT,
+              CallingConvention CallingConventionT,
+              bool IsVariadicT,
+              bool IsConstT,
+              bool IsVolatileT,
+              RefQualifier RefQualifierT,
+              bool IsNoexceptT,
+              typename ArgsT>
+    using BuildFunctionType_t = typename BuildFunctionType<ReturnTypeT, ClassT, CallingConventionT, IsVariadicT, IsConstT, IsVolatileT, RefQualifierT, IsNoexceptT, ArgsT>::Type;
+
+    ///////////////////////////////////////////////////////////////////////
+    // CvMigrator, RefMigrator and PointerMigrator. Used by the "Migrate"
+    // aliases of "FunctionTraitsHelper" just below to apply the
+    // cv-qualifiers, reference or pointer of one type "F1" to another
+    // "F2". Each is selected by "F1" alone (so once per "FunctionTraits"
+    // specialization), and its "Type" alias then forms only the single
+    // type that's required, using the core language's own syntax for
+    // it. Using "std::conditional_t" and "std::add_pointer_t", etc.
+    // instead instantiates every alternative (as a class template
+    // specialized on "F2") whether it's required or not, which is very
+    // costly when "F2" is a function type with many args (GCC 12 for
+    // instance allocates about 12MB for each "FunctionTraits" member
+    // alias that migrates "F1" to a function with 4000 args that way).
+    ///////////////////////////////////////////////////////////////////////
+    template <bool IsConstT, bool IsVolatileT>
+    struct CvMigrator
+    {
+        template <typename F2>
+        using Type = F2;
+    };
+
+    template <>
+    struct CvMigrator<true, false>
+    {
+        template <typename F2>
+        using Type = const F2;
+    };
+
+    template <>
+    struct CvMigrator<false, true>
+    {
+        template <typename F2>
+        using Type = volatile F2;
+    };
+
+    template <>
+    struct CvMigrator<true, true>
+    {
+        template <typename F2>
+        using Type = const volatile F2;
+    };
+
+    template <typename F1>
+    struct RefMigrator
+    {
+        template <typename F2>
+        using Type = F2;
+    };
+
+    template <typename F1>
+    struct RefMigrator<F1 &>
+    {
+        template <typename F2>
+        using Type = F2 &;
+    };
+
+    template <typename F1>
+    struct RefMigrator<F1 &&>
+    {
+        template <typename F2>
+        using Type = F2 &&;
+    };
+
+    template <typename F1>
+    using CvMigrator_t = CvMigrator<std::is_const_v<std::remove_reference_t<F1>>,
+                                    std::is_volatile_v<std::remove_reference_t<F1>>>;
+
+    template <bool IsPointerT>
+    struct PointerMigrator
+    {
+        template <typename F1, typename F2>
+        using Type = F2;
+    };
+
+    template <>
+    struct PointerMigrator<true>
+    {
+        template <typename F1, typename F2>
+        using Type = typename CvMigrator_t<F1>::template Type<F2 *>;
+    };
+
     ///////////////////////////////////////////////////////////////////////
     // FunctionTraitsHelper. Base class of "FunctionTraitsBase" which all
     // "FunctionTraits" deriviatives (specializations) ultimately inherit
@@ -2133,34 +3200,21 @@ namespace Private
     ///////////////////////////////////////////////////////////////////////
     class FunctionTraitsHelper
     {
+        // See "CvMigrator" and "RefMigrator" above
         template <typename F1, typename F2>
-        using MigrateConst = std::conditional_t<std::is_const_v<std::remove_reference_t<F1>>,
-                                                std::add_const_t<F2>,
-                                                F2>;
-
-        template <typename F1, typename F2>
-        using MigrateVolatile = std::conditional_t<std::is_volatile_v<std::remove_reference_t<F1>>,
-                                                   std::add_volatile_t<F2>,
-                                                   F2>;
-
-        template <typename F1, typename F2>
-        using MigrateCv = MigrateVolatile<F1, MigrateConst<F1, F2>>;
+        using MigrateCv = typename CvMigrator_t<F1>::template Type<F2>;
 
         template <typename F1, typename F2>
-        using MigrateRef = std::conditional_t<std::is_lvalue_reference_v<F1>,
-                                              std::add_lvalue_reference_t<F2>,
-                                              std::conditional_t<std::is_rvalue_reference_v<F1>,
-                                                                 std::add_rvalue_reference_t<F2>,
-                                                                 F2>>;
+        using MigrateRef = typename RefMigrator<F1>::template Type<F2>;
 
         /////////////////////////////////////////////////////////////
         // ReplaceArgsTupleImpl (primary template). Implements the
         // "ReplaceArgsTuple" alias seen in all "FunctionTraits"
         // derivatives (specializations). Primary template is never
-        // used however, only the partial specialization just below
-        // is when the 2nd template arg is a "std::tuple". It always
-        // will be by design or the "static_assert" just below kicks
-        // in.
+        // used however, only the partial specializations just below
+        // are when the 2nd template arg is a "std::tuple" or (for
+        // internal use only) a "TypeList". It always will be by
+        // design or the "static_assert" just below kicks in.
         /////////////////////////////////////////////////////////////
         template <template<typename... NewArgsT> class ReplaceArgsT,
                   typename T>
@@ -2181,13 +3235,24 @@ namespace Private
             using Type = ReplaceArgsT<NewArgsT...>;
         };
 
+        ///////////////////////////////////////////////////////////////////
+        // ReplaceArgsTupleImpl (partial specialization when 2nd arg is a
+        // "TypeList"). Used internally by the "ReplaceNthArg" alias seen
+        // in all "FunctionTraits" derivatives (specializations) so that
+        // no "std::tuple" needs to be instantiated.
+        ///////////////////////////////////////////////////////////////////
+        template <template<typename...> class ReplaceArgsT,
+                  typename... NewArgsT>
+        struct ReplaceArgsTupleImpl<ReplaceArgsT, TypeList<NewArgsT...>>
+        {
+            using Type = ReplaceArgsT<NewArgsT...>;
+        };
+
     protected:
         // Called for free functions only in this release (including static member functions)
         template <typename F1, typename F2>
         using MigratePointerAndRef = MigrateRef<F1,
-                                                std::conditional_t<std::is_pointer_v<std::remove_reference_t<F1>>,
-                                                                   MigrateCv<F1, std::add_pointer_t<F2>>,
-                                                                   F2>>;
+                                                typename PointerMigrator<std::is_pointer_v<std::remove_reference_t<F1>>>::template Type<F1, F2>>;
 
         // Called for non-static member functions only in this release
         template <typename F1, typename F2>
@@ -2197,10 +3262,13 @@ namespace Private
         // Helper alias for "ReplaceArgsTupleImpl" template above.
         // Implements the public "ReplaceArgsTuple" alias seen in
         // all "FunctionTraits" derivatives (specializations).
-        // Latter alias just defers to this one.
+        // Latter alias just defers to this one. Note that
+        // "NewArgsTupleT" can also be a "TypeList" (for internal
+        // use only - the public "ReplaceArgsTuple" alias only
+        // accepts a "std::tuple").
         ///////////////////////////////////////////////////////////
         template <template<typename... NewArgsT> class ReplaceArgsT,
-                  TUPLE_C NewArgsTupleT>
+                  typename NewArgsTupleT>
         using ReplaceArgsTupleImpl_t = typename ReplaceArgsTupleImpl<ReplaceArgsT, NewArgsTupleT>::Type;
     };
 
@@ -2402,6 +3470,16 @@ namespace Private
         ///////////////////////////////////////////////////////////////////////
         using ArgTypes = std::tuple<ArgsT...>;
 
+        ///////////////////////////////////////////////////////////////////////
+        // Same as "ArgTypes" just above but a "TypeList" instead of a
+        // "std::tuple" (cheaper to instantiate so you may wish to rely on it
+        // instead when you just need to inspect the types themselves). Note
+        // that alias "ArgTypes" above isn't instantiated unless you use it
+        // (in a context requiring a complete type). It can also be accessed
+        // via "ArgTypeList::Tuple" (same type). See "TypeList" for details.
+        ///////////////////////////////////////////////////////////////////////
+        using ArgTypeList = TypeList<ArgsT...>;
+
         ///////////////////////////////////////////////////////////////////
         // Number of arguments in the function. This is officially called
         // "arity" but the term is obscure so we'll stick with a name
@@ -2475,7 +3553,7 @@ namespace Private
                                         "(i.e., the number of arguments in the function this struct is being specialized on). Note "
                                         "that the number of function arguments can be retrieved by member \"ArgCount\" or its more "
                                         "user friendly helper template \"ArgCount_v\" (should you require this).");
-            using Type = std::tuple_element_t<I, ArgTypes>;
+            using Type = typename PackIndexer<ArgsT...>::template At<I>::Type;
         };
 
         //////////////////////////////////////////////////////////////
@@ -2610,45 +3688,19 @@ namespace Private
                            IS_NOEXCEPT, \
                            ArgsT...>
 
-    //////////////////////////////////////////////////////////////////////////////////////
-    // REPLACE_CALLING_CONVENTION_TUPLE_ALL_COMPILERS (combines with macro just below to
-    // implement "FreeFunctionTraits::ReplaceCallingConvention" for non-variadic free
-    // functions). Note that the the (zero-based) 4th entry in the tuple we're creating
-    // below is for handling STDEXT_CC_THISCALL. It's not supported for free functions
-    // so if someone calls "FreeFunctionTraits::ReplaceCallingConvention" and passes
-    // "CallingConvention::Thiscall" for its template arg, the 4th entry below will kick
-    // in to handle it, thus ensuring the calling convention remains unchanged ("CC" in
-    // the 4th entry below will be the calling convention of the function the user is
-    // targeting so it remains unchanged).
-    //////////////////////////////////////////////////////////////////////////////////////
-    #define REPLACE_CALLING_CONVENTION_TUPLE_ALL_COMPILERS(CC, ARGS, IS_NOEXCEPT) \
-        std::tuple<R STDEXT_CC_CDECL ARGS noexcept(IS_NOEXCEPT), \
-                   R STDEXT_CC_STDCALL ARGS noexcept(IS_NOEXCEPT), \
-                   R STDEXT_CC_FASTCALL ARGS noexcept(IS_NOEXCEPT), \
-                   R STDEXT_CC_VECTORCALL ARGS noexcept(IS_NOEXCEPT), \
-                   R CC ARGS noexcept(IS_NOEXCEPT)
-
-    /////////////////////////////////////////////////////////////////////
-    // REPLACE_CALLING_CONVENTION_TUPLE (combines with macro just below
-    // to implement "FreeFunctionTraits::ReplaceCallingConvention" for
-    // non-variadic free functions)
-    /////////////////////////////////////////////////////////////////////
-    #if !defined (STDEXT_CC_REGCALL)
-        #define REPLACE_CALLING_CONVENTION_TUPLE(CC, ARGS, IS_NOEXCEPT) \
-            REPLACE_CALLING_CONVENTION_TUPLE_ALL_COMPILERS(CC, ARGS, IS_NOEXCEPT)>
-    #else
-        #define REPLACE_CALLING_CONVENTION_TUPLE(CC, ARGS, IS_NOEXCEPT) \
-            REPLACE_CALLING_CONVENTION_TUPLE_ALL_COMPILERS(CC, ARGS, IS_NOEXCEPT) \
-            , R STDEXT_CC_REGCALL ARGS noexcept(IS_NOEXCEPT)>
-    #endif
-
     ///////////////////////////////////////////////////////////////////////////////////
     // REPLACE_CALLING_CONVENTION (macro used to implement
-    // "FreeFunctionTraits::ReplaceCallingConvention" for non-variadic free functions)
+    // "FreeFunctionTraits::ReplaceCallingConvention" for non-variadic free functions).
+    // Forms only the requested function type, via the "FreeFunctionTypeBuilder"
+    // explicit specialization for "NewCallingConventionT" (a simple lookup). Note that
+    // STDEXT_CC_THISCALL isn't supported for free functions so if someone passes
+    // "CallingConvention::Thiscall", the calling convention of the function the user
+    // is targeting is used instead (so it remains unchanged).
     ///////////////////////////////////////////////////////////////////////////////////
     #define REPLACE_CALLING_CONVENTION(CC, ARGS, IS_NOEXCEPT) \
-        std::tuple_element_t<static_cast<std::size_t>(NewCallingConventionT), \
-                             REPLACE_CALLING_CONVENTION_TUPLE(CC, ARGS, IS_NOEXCEPT)>
+        typename FreeFunctionTypeBuilder<NewCallingConventionT != StdExt::CallingConvention::Thiscall ? NewCallingConventionT \
+                                                                                                      : BaseClass::CallingConvention, \
+                                         false>::template Type<R, void, IS_NOEXCEPT, ArgsT...>
 
     ///////////////////////////////////////////////////////////////////////////
     // Macro for internal use only (#undefined when we're done with it).
@@ -2711,7 +3763,7 @@ namespace Private
             template <TUPLE_C NewArgsTupleT> \
             using ReplaceArgsTuple = typename BaseClass::template ReplaceArgsTupleImpl_t<ReplaceArgs, NewArgsTupleT>; \
             template <std::size_t N, typename NewArgT> \
-            using ReplaceNthArg = ReplaceArgsTuple<ReplaceNthType_t<N, NewArgT, ArgsT...>>; \
+            using ReplaceNthArg = typename BaseClass::template ReplaceArgsTupleImpl_t<ReplaceArgs, ReplaceNthTypeList_t<N, NewArgT, ArgsT...>>; \
         };
 
     // noexcept (macro for internal use only - invokes macro just above)
@@ -2734,18 +3786,22 @@ namespace Private
     // internal use only - invokes macro just above).
     /////////////////////////////////////////////////////////////
     MAKE_FREE_FUNC_TRAITS_NON_VARIADIC(STDEXT_CC_CDECL,      CallingConvention::Cdecl)
-    MAKE_FREE_FUNC_TRAITS_NON_VARIADIC(STDEXT_CC_STDCALL,    CallingConvention::Stdcall)
-    MAKE_FREE_FUNC_TRAITS_NON_VARIADIC(STDEXT_CC_FASTCALL,   CallingConvention::Fastcall)
-    MAKE_FREE_FUNC_TRAITS_NON_VARIADIC(STDEXT_CC_VECTORCALL, CallingConvention::Vectorcall)
-    #ifdef STDEXT_CC_REGCALL
+    #if STDEXT_CC_STDCALL_SPECIALIZED
+        MAKE_FREE_FUNC_TRAITS_NON_VARIADIC(STDEXT_CC_STDCALL,    CallingConvention::Stdcall)
+    #endif
+    #if STDEXT_CC_FASTCALL_SPECIALIZED
+        MAKE_FREE_FUNC_TRAITS_NON_VARIADIC(STDEXT_CC_FASTCALL,   CallingConvention::Fastcall)
+    #endif
+    #if STDEXT_CC_VECTORCALL_SPECIALIZED
+        MAKE_FREE_FUNC_TRAITS_NON_VARIADIC(STDEXT_CC_VECTORCALL, CallingConvention::Vectorcall)
+    #endif
+    #if defined(STDEXT_CC_REGCALL) && STDEXT_CC_REGCALL_SPECIALIZED
         MAKE_FREE_FUNC_TRAITS_NON_VARIADIC(STDEXT_CC_REGCALL, CallingConvention::Regcall)
     #endif
 
     // Done with these
     #undef MAKE_FREE_FUNC_TRAITS_NON_VARIADIC
     #undef REPLACE_CALLING_CONVENTION
-    #undef REPLACE_CALLING_CONVENTION_TUPLE
-    #undef REPLACE_CALLING_CONVENTION_TUPLE_ALL_COMPILERS
 
     ////////////////////////////////////////////////////////
     // REPLACE_CALLING_CONVENTION (macro used to implement
@@ -2841,40 +3897,19 @@ namespace Private
                            IS_NOEXCEPT, \
                            ArgsT...>
 
-    /////////////////////////////////////////////////////////////////////////////
-    // REPLACE_CALLING_CONVENTION_TUPLE_ALL_COMPILERS (combines with macro just
-    // below to implement "MemberFunctionTraits::ReplaceCallingConvention" for
-    // non-variadic, non-static member functions)
-    /////////////////////////////////////////////////////////////////////////////
-    #define REPLACE_CALLING_CONVENTION_TUPLE_ALL_COMPILERS(ARGS, CONST, VOLATILE, REF, IS_NOEXCEPT) \
-        std::tuple<R (STDEXT_CC_CDECL C::*)ARGS CONST VOLATILE REF noexcept(IS_NOEXCEPT), \
-                   R (STDEXT_CC_STDCALL C::*)ARGS CONST VOLATILE REF noexcept(IS_NOEXCEPT), \
-                   R (STDEXT_CC_FASTCALL C::*)ARGS CONST VOLATILE REF noexcept(IS_NOEXCEPT), \
-                   R (STDEXT_CC_VECTORCALL C::*)ARGS CONST VOLATILE REF noexcept(IS_NOEXCEPT), \
-                   R (STDEXT_CC_THISCALL C::*)ARGS CONST VOLATILE REF noexcept(IS_NOEXCEPT)
-
-    /////////////////////////////////////////////////////////////////////
-    // REPLACE_CALLING_CONVENTION_TUPLE (combines with macro just below
-    // to implement "MemberFunctionTraits::ReplaceCallingConvention" for
-    // non-variadic, non-static member functions)
-    /////////////////////////////////////////////////////////////////////
-    #if !defined (STDEXT_CC_REGCALL)
-        #define REPLACE_CALLING_CONVENTION_TUPLE(ARGS, CONST, VOLATILE, REF, IS_NOEXCEPT) \
-            REPLACE_CALLING_CONVENTION_TUPLE_ALL_COMPILERS(ARGS, CONST, VOLATILE, REF, IS_NOEXCEPT)>
-    #else
-        #define REPLACE_CALLING_CONVENTION_TUPLE(ARGS, CONST, VOLATILE, REF, IS_NOEXCEPT) \
-            REPLACE_CALLING_CONVENTION_TUPLE_ALL_COMPILERS(ARGS, CONST, VOLATILE, REF, IS_NOEXCEPT) \
-            , R (STDEXT_CC_REGCALL C::*)ARGS CONST VOLATILE REF noexcept(IS_NOEXCEPT)>
-    #endif
-
-    /////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////
     // REPLACE_CALLING_CONVENTION (macro used to implement
-    // "MemberFunctionTraits::ReplaceCallingConvention" for
-    // non-variadic, non-static member functions)
-    /////////////////////////////////////////////////////////
+    // "MemberFunctionTraits::ReplaceCallingConvention" for non-variadic,
+    // non-static member functions). Forms only the requested function type,
+    // via the "MemberFunctionTypeBuilder" explicit specialization for
+    // "NewCallingConventionT" and the function's cv and ref-qualifiers.
+    /////////////////////////////////////////////////////////////////////////
     #define REPLACE_CALLING_CONVENTION(ARGS, CONST, VOLATILE, REF, IS_NOEXCEPT) \
-        std::tuple_element_t<static_cast<std::size_t>(NewCallingConventionT), \
-                             REPLACE_CALLING_CONVENTION_TUPLE(ARGS, CONST, VOLATILE, REF, IS_NOEXCEPT)>
+        typename MemberFunctionTypeBuilder<NewCallingConventionT, \
+                                           false, \
+                                           BaseClass::IsConst, \
+                                           BaseClass::IsVolatile, \
+                                           BaseClass::RefQualifier>::template Type<R, C, IS_NOEXCEPT, ArgsT...>
 
     ///////////////////////////////////////////////////////////////////////////
     // Macro for internal use only (#undefined when we're done with it).
@@ -2958,7 +3993,7 @@ namespace Private
             template <TUPLE_C NewArgsTupleT> \
             using ReplaceArgsTuple = typename BaseClass::template ReplaceArgsTupleImpl_t<ReplaceArgs, NewArgsTupleT>; \
             template <std::size_t N, typename NewArgT> \
-            using ReplaceNthArg = ReplaceArgsTuple<ReplaceNthType_t<N, NewArgT, ArgsT...>>; \
+            using ReplaceNthArg = typename BaseClass::template ReplaceArgsTupleImpl_t<ReplaceArgs, ReplaceNthTypeList_t<N, NewArgT, ArgsT...>>; \
         };
 
     //////////////////////////////////////////////////////////////////////////////////////////
@@ -3035,19 +4070,56 @@ namespace Private
     // further details)
     ////////////////////////////////////////////////////////////
     MAKE_MEMBER_FUNC_TRAITS_NON_VARIADIC(STDEXT_CC_CDECL,      CallingConvention::Cdecl)
-    MAKE_MEMBER_FUNC_TRAITS_NON_VARIADIC(STDEXT_CC_THISCALL,   CallingConvention::Thiscall)
-    MAKE_MEMBER_FUNC_TRAITS_NON_VARIADIC(STDEXT_CC_STDCALL,    CallingConvention::Stdcall)
-    MAKE_MEMBER_FUNC_TRAITS_NON_VARIADIC(STDEXT_CC_FASTCALL,   CallingConvention::Fastcall)
-    MAKE_MEMBER_FUNC_TRAITS_NON_VARIADIC(STDEXT_CC_VECTORCALL, CallingConvention::Vectorcall)
-    #ifdef STDEXT_CC_REGCALL
+    #if STDEXT_CC_THISCALL_SPECIALIZED
+        MAKE_MEMBER_FUNC_TRAITS_NON_VARIADIC(STDEXT_CC_THISCALL,   CallingConvention::Thiscall)
+    #endif
+    #if STDEXT_CC_STDCALL_SPECIALIZED
+        MAKE_MEMBER_FUNC_TRAITS_NON_VARIADIC(STDEXT_CC_STDCALL,    CallingConvention::Stdcall)
+    #endif
+    #if STDEXT_CC_FASTCALL_SPECIALIZED
+        MAKE_MEMBER_FUNC_TRAITS_NON_VARIADIC(STDEXT_CC_FASTCALL,   CallingConvention::Fastcall)
+    #endif
+    #if STDEXT_CC_VECTORCALL_SPECIALIZED
+        MAKE_MEMBER_FUNC_TRAITS_NON_VARIADIC(STDEXT_CC_VECTORCALL, CallingConvention::Vectorcall)
+    #endif
+    #if defined(STDEXT_CC_REGCALL) && STDEXT_CC_REGCALL_SPECIALIZED
         MAKE_MEMBER_FUNC_TRAITS_NON_VARIADIC(STDEXT_CC_REGCALL, CallingConvention::Regcall)
     #endif
 
+    ///////////////////////////////////////////////////////////////////
+    // If STDEXT_CC_PRUNE is #defined then make sure the compiler
+    // really does replace each calling convention we skipped above
+    // with STDEXT_CC_CDECL (for both free and non-static member
+    // functions), since functions declared with them would otherwise
+    // no longer be supported (see STDEXT_CC_PRUNE for details).
+    // Deliberately skipped when STDEXT_CC_ONLY_CDECL is #defined.
+    ///////////////////////////////////////////////////////////////////
+    #if !defined(STDEXT_CC_ONLY_CDECL)
+        #define STATIC_ASSERT_CC_PRUNED(CALLING_CONVENTION, IS_SPECIALIZED) \
+            static_assert(IS_SPECIALIZED || \
+                          (CallingConventionReplacedWithCdecl<CALLING_CONVENTION, true>() && \
+                           CallingConventionReplacedWithCdecl<CALLING_CONVENTION, false>()), \
+                          "STDEXT_CC_PRUNE skipped the \"FunctionTraits\" specializations for a calling convention " \
+                          "the compiler doesn't replace with cdecl (#undef STDEXT_CC_PRUNE to resolve)");
+
+        STATIC_ASSERT_CC_PRUNED(CallingConvention::Stdcall,    STDEXT_CC_STDCALL_SPECIALIZED)
+        STATIC_ASSERT_CC_PRUNED(CallingConvention::Fastcall,   STDEXT_CC_FASTCALL_SPECIALIZED)
+        STATIC_ASSERT_CC_PRUNED(CallingConvention::Vectorcall, STDEXT_CC_VECTORCALL_SPECIALIZED)
+        #if defined(STDEXT_CC_REGCALL)
+            STATIC_ASSERT_CC_PRUNED(CallingConvention::Regcall, STDEXT_CC_REGCALL_SPECIALIZED)
+        #endif
+
+        #undef STATIC_ASSERT_CC_PRUNED // Done with this
+
+        static_assert(STDEXT_CC_THISCALL_SPECIALIZED ||
+                      CallingConventionReplacedWithCdecl<CallingConvention::Thiscall, false>(),
+                      "STDEXT_CC_PRUNE skipped the \"FunctionTraits\" specializations for a calling convention "
+                      "the compiler doesn't replace with cdecl (#undef STDEXT_CC_PRUNE to resolve)");
+    #endif
+
      // Done with these
     #undef MAKE_MEMBER_FUNC_TRAITS_NON_VARIADIC
     #undef REPLACE_CALLING_CONVENTION
-    #undef REPLACE_CALLING_CONVENTION_TUPLE
-    #undef REPLACE_CALLING_CONVENTION_TUPLE_ALL_COMPILERS
 
     //////////////////////////////////////////////////////////
     // REPLACE_CALLING_CONVENTION (macro used to implement
@@ -3105,6 +4177,7 @@ namespace Private
         constexpr static bool IsFunctor = true;
     };
 } // namespace Private
+STDEXT_END_PRIVATE
 
 //////////////////////////////////////////////////////////////////////////
 // FunctionTraits (primary template). Template that all users rely on to
@@ -3425,12 +4498,20 @@ struct FunctionTraits<F,
 //       // zero-based index of the arg we want).
 //       ////////////////////////////////////////////////////////
 //       using Arg2Type_t = ArgType_t<F, 1>;
+//
+// Note that "F" is passed to "Private::FunctorTraits" with any cv-qualifiers
+// and reference removed, so all variants of the same functor type (such as
+// "F", "const F", "F &", "const F &" and "F &&") share the same base class,
+// which is therefore instantiated only once (along with all its nested
+// aliases and the "MemberFunctionTraits" specialization it derives from),
+// instead of once for each variant. The traits of a functor don't depend on
+// these qualifiers anyway since they're the traits of its "operator()".
 //////////////////////////////////////////////////////////////////////////
 template <typename F>
 struct FunctionTraits<F,
                       std::enable_if_t<Private::IsTraitsFunctor_v<F>>> : // True if "F" is a functor
                                                                          // or a reference to one
-    Private::FunctorTraits<F>
+    Private::FunctorTraits<RemoveCvRef<F>>
 {   
 };
 
@@ -3649,6 +4730,15 @@ inline constexpr tstring_view FunctionTraitsArgTypeName_v = TypeName_v<FunctionT
 template <FUNCTION_TRAITS_C FunctionTraitsT>
 using FunctionTraitsArgTypes_t = typename FunctionTraitsT::ArgTypes;
 
+////////////////////////////////////////////////////////////////////////////
+// FunctionTraitsArgTypeList_t. Same as "FunctionTraitsArgTypes_t" just
+// above but yields "FunctionTraitsT::ArgTypeList" instead (a "TypeList"
+// instead of a "std::tuple" - cheaper to instantiate). See
+// "FunctionTraitsArgTypes_t" above and "TypeList" for details.
+////////////////////////////////////////////////////////////////////////////
+template <FUNCTION_TRAITS_C FunctionTraitsT>
+using FunctionTraitsArgTypeList_t = typename FunctionTraitsT::ArgTypeList;
+
 //////////////////////////////////////////////////////////////////////
 // FunctionTraitsCallingConvention_v. Helper template template
 // yielding "FunctionTraitsT::CallingConvention" (the calling
@@ -4400,6 +5490,127 @@ using FunctionTraitsReplaceArgsTuple_t = typename FunctionTraitsT::template Repl
 template <FUNCTION_TRAITS_C FunctionTraitsT, std::size_t N, typename NewArgT>
 using FunctionTraitsReplaceNthArg_t = typename FunctionTraitsT::template ReplaceNthArg<N, NewArgT>;
 
+/////////////////////////////////////////////////////////////////////////////
+// STDEXT_TRAITS_PROFILE. Opt-in #defined constant you can #define before
+// #including this header to diagnose which of the helper templates below
+// are responsible for slow builds. Most of these helpers are alias
+// templates that simply defer to "FunctionTraits" (and its own helpers
+// above), but aliases are transparent to the compiler, so compile-time
+// profilers such as Clang's "-ftime-trace" or MSFT's "/d1templateStats"
+// attribute all their cost to "FunctionTraits" itself (or whatever
+// templates it instantiates), not to the helper your code actually used.
+// When STDEXT_TRAITS_PROFILE is #defined, each helper seen in the
+// following namespace instead defers to a class template of the same name
+// in namespace "StdExt::Private::TraitsProfile" (below), so each use of
+// the helper shows up as a distinct instantiation with the helper's name,
+// under which the profiler then reports the instantiations it triggers
+// (note that "TypeName_v" and "ForEachArg" don't need this since they
+// already appear in the profiler's output, as
+// "Private::TypeNameImpl::Get<T>" and "ForEachArg<F>" respectively). The
+// results are otherwise identical (and you should normally leave it
+// #undefined since these extra instantiations make compilation a bit
+// slower). See "TraitsProfile.py" for a script that groups the output of
+// "-ftime-trace" by helper.
+//
+// IMPORTANT:
+// ---------
+// Only #define STDEXT_TRAITS_PROFILE in builds you're profiling, never in
+// code that relies on these helpers in SFINAE contexts ("std::void_t",
+// "std::enable_if_t", "std::is_detected"-style checks and the like, or
+// "requires" expressions in C++20). Normally, template args the aliases
+// can't be formed from (such as "void" passed to "ReplaceArgs_t" as an arg
+// type) cause a substitution failure in such a context, but when routed
+// through a "TraitsProfile" class template the failure occurs while
+// instantiating that class instead, outside the alias' immediate context,
+// so it's a hard error. The "TRAITS_FUNCTION_C" constraint on "F" in
+// C++20 still applies to the alias itself however, so it's unaffected.
+//
+// STDEXT_TRAITS_PROFILE_HELPER is for internal use only. It resolves to
+// "TYPE" normally, or the "Type" alias in the given class template in
+// namespace "TraitsProfile" if STDEXT_TRAITS_PROFILE is #defined, where
+// "ARGS" is the (parenthesized) template args to pass to it.
+/////////////////////////////////////////////////////////////////////////////
+#define STDEXT_TRAITS_PROFILE_EXPAND(...) __VA_ARGS__
+
+#if defined(STDEXT_TRAITS_PROFILE)
+    #define STDEXT_TRAITS_PROFILE_HELPER(NAME, ARGS, ...) typename Private::TraitsProfile::NAME<STDEXT_TRAITS_PROFILE_EXPAND ARGS>::Type
+
+    STDEXT_BEGIN_PRIVATE
+    {
+        namespace TraitsProfile
+        {
+            template <typename F>
+            struct ArgCount_v
+            {
+                using Type = std::integral_constant<std::size_t, FunctionTraitsArgCount_v<FunctionTraits<F>>>;
+            };
+
+            template <typename F, std::size_t I>
+            struct ArgType_t
+            {
+                using Type = FunctionTraitsArgType_t<FunctionTraits<F>, I>;
+            };
+
+            template <typename F>
+            struct ArgTypes_t
+            {
+                using Type = FunctionTraitsArgTypes_t<FunctionTraits<F>>;
+            };
+
+            template <typename F>
+            struct ArgTypeList_t
+            {
+                using Type = FunctionTraitsArgTypeList_t<FunctionTraits<F>>;
+            };
+
+            template <typename F>
+            struct FunctionType_t
+            {
+                using Type = FunctionTraitsFunctionType_t<FunctionTraits<F>>;
+            };
+
+            template <typename F>
+            struct ReturnType_t
+            {
+                using Type = FunctionTraitsReturnType_t<FunctionTraits<F>>;
+            };
+
+            template <typename F, CallingConvention NewCallingConventionT>
+            struct ReplaceCallingConvention_t
+            {
+                using Type = FunctionTraitsReplaceCallingConvention_t<FunctionTraits<F>, NewCallingConventionT>;
+            };
+
+            template <typename F, typename NewReturnTypeT>
+            struct ReplaceReturnType_t
+            {
+                using Type = FunctionTraitsReplaceReturnType_t<FunctionTraits<F>, NewReturnTypeT>;
+            };
+
+            template <typename F, typename... NewArgsT>
+            struct ReplaceArgs_t
+            {
+                using Type = FunctionTraitsReplaceArgs_t<FunctionTraits<F>, NewArgsT...>;
+            };
+
+            template <typename F, typename NewArgsTupleT>
+            struct ReplaceArgsTuple_t
+            {
+                using Type = FunctionTraitsReplaceArgsTuple_t<FunctionTraits<F>, NewArgsTupleT>;
+            };
+
+            template <typename F, std::size_t N, typename NewArgT>
+            struct ReplaceNthArg_t
+            {
+                using Type = FunctionTraitsReplaceNthArg_t<FunctionTraits<F>, N, NewArgT>;
+            };
+        } // namespace TraitsProfile
+    } // namespace Private
+    STDEXT_END_PRIVATE
+#else
+    #define STDEXT_TRAITS_PROFILE_HELPER(NAME, ARGS, ...) __VA_ARGS__
+#endif
+
 /////////////////////////////////////////////////////////////////////////
 // ArgCount_v. Helper template for "FunctionTraits::ArgCount" which
 // yields the number of args in function "F" not including variadic args
@@ -4416,7 +5627,12 @@ using FunctionTraitsReplaceNthArg_t = typename FunctionTraitsT::template Replace
 // "IsEmptyArgList_v" instead. See this for further details.
 /////////////////////////////////////////////////////////////////////////
 template <TRAITS_FUNCTION_C F>
-inline constexpr std::size_t ArgCount_v = FunctionTraitsArgCount_v<FunctionTraits<F>>; // Defers to the "FunctionTraits" helper further above
+#if defined(STDEXT_TRAITS_PROFILE)
+    // Value of "Private::TraitsProfile::ArgCount_v" (see STDEXT_TRAITS_PROFILE)
+    inline constexpr std::size_t ArgCount_v = Private::TraitsProfile::ArgCount_v<F>::Type::value;
+#else
+    inline constexpr std::size_t ArgCount_v = FunctionTraitsArgCount_v<FunctionTraits<F>>; // Defers to the "FunctionTraits" helper further above
+#endif
 
 ////////////////////////////////////////////////////////////////////////////
 // ArgType_t. Helper alias for "FunctionTraits::Args" but less verbose than
@@ -4450,7 +5666,7 @@ inline constexpr std::size_t ArgCount_v = FunctionTraitsArgCount_v<FunctionTrait
 //                                                                          // function as well)
 ////////////////////////////////////////////////////////////////////////////
 template <TRAITS_FUNCTION_C F, std::size_t I /* Zero-based */>
-using ArgType_t = FunctionTraitsArgType_t<FunctionTraits<F>, I>; // Defers to the "FunctionTraits" helper further above
+using ArgType_t = STDEXT_TRAITS_PROFILE_HELPER(ArgType_t, (F, I), FunctionTraitsArgType_t<FunctionTraits<F>, I>); // Defers to the "FunctionTraits" helper further above
 
 //////////////////////////////////////////////////////////////////////
 // ArgTypeName(). See "ArgType_t()" just above. Simply converts that
@@ -4496,7 +5712,15 @@ inline constexpr tstring_view ArgTypeName_v = FunctionTraitsArgTypeName_v<Functi
 //                                                                                   // function as well)
 /////////////////////////////////////////////////////////////////////////
 template <TRAITS_FUNCTION_C F>
-using ArgTypes_t = FunctionTraitsArgTypes_t<FunctionTraits<F>>; // Defers to the "FunctionTraits" helper further above
+using ArgTypes_t = STDEXT_TRAITS_PROFILE_HELPER(ArgTypes_t, (F), FunctionTraitsArgTypes_t<FunctionTraits<F>>); // Defers to the "FunctionTraits" helper further above
+
+/////////////////////////////////////////////////////////////////////////
+// ArgTypeList_t. Same as "ArgTypes_t" just above but yields a
+// "TypeList" instead of a "std::tuple" (cheaper to instantiate). See
+// "ArgTypes_t" above and "TypeList" for details.
+/////////////////////////////////////////////////////////////////////////
+template <TRAITS_FUNCTION_C F>
+using ArgTypeList_t = STDEXT_TRAITS_PROFILE_HELPER(ArgTypeList_t, (F), FunctionTraitsArgTypeList_t<FunctionTraits<F>>); // Defers to the "FunctionTraits" helper further above
 
 ///////////////////////////////////////////////////////////////////////////////
 // CallingConvention_v. Helper template for "FunctionTraits::CallingConvention"
@@ -4550,7 +5774,7 @@ inline constexpr tstring_view CallingConventionName_v = FunctionTraitsCallingCon
 //                                                                                     // references to pointers to the function as well)
 ////////////////////////////////////////////////////////////////////
 template <TRAITS_FUNCTION_C F>
-using FunctionType_t = FunctionTraitsFunctionType_t<FunctionTraits<F>>; // Defers to the "FunctionTraits" helper further above
+using FunctionType_t = STDEXT_TRAITS_PROFILE_HELPER(FunctionType_t, (F), FunctionTraitsFunctionType_t<FunctionTraits<F>>); // Defers to the "FunctionTraits" helper further above
 
 /////////////////////////////////////////////////////////////////////////
 // FunctionTypeName_v. See "FunctionType_t" just above. Simply converts
@@ -4749,7 +5973,7 @@ inline constexpr tstring_view MemberFunctionRefQualifierName_v = FunctionTraitsM
 //                                                                                         // function as well)
 ///////////////////////////////////////////////////////////////////////////
 template <TRAITS_FUNCTION_C F>
-using ReturnType_t = FunctionTraitsReturnType_t<FunctionTraits<F>>; // Defers to the "FunctionTraits" helper further above
+using ReturnType_t = STDEXT_TRAITS_PROFILE_HELPER(ReturnType_t, (F), FunctionTraitsReturnType_t<FunctionTraits<F>>); // Defers to the "FunctionTraits" helper further above
 
 //////////////////////////////////////////////////////////////////////////
 // ReturnTypeName(). See "ReturnType_t()" just above. Simply converts
@@ -4927,7 +6151,18 @@ using RemoveNoexcept_t = FunctionTraitsRemoveNoexcept_t<FunctionTraits<F>>; // D
 // (since that's what the compiler actually uses).
 //////////////////////////////////////////////////////////////////////////
 template <TRAITS_FUNCTION_C F, CallingConvention NewCallingConventionT>
-using ReplaceCallingConvention_t = FunctionTraitsReplaceCallingConvention_t<FunctionTraits<F>, NewCallingConventionT>; // Defers to the "FunctionTraits" helper further above
+using ReplaceCallingConvention_t = STDEXT_TRAITS_PROFILE_HELPER(ReplaceCallingConvention_t, (F, NewCallingConventionT), FunctionTraitsReplaceCallingConvention_t<FunctionTraits<F>, NewCallingConventionT>); // Defers to the "FunctionTraits" helper further above
+
+//////////////////////////////////////////////////////////////////////////
+// ReplaceCallingConventionAll_t. "TypeList" of each function in "Fs"
+// after replacing its calling convention with "NewCallingConventionT",
+// i.e., "TypeList<ReplaceCallingConvention_t<Fs, NewCallingConventionT>...>"
+// (see "ReplaceCallingConvention_t" just above for details). Retargets
+// an entire pack of functions in a single pack expansion (such as all
+// the entry points of an ABI adapter).
+//////////////////////////////////////////////////////////////////////////
+template <CallingConvention NewCallingConventionT, TRAITS_FUNCTION_C... Fs>
+using ReplaceCallingConventionAll_t = TypeList<ReplaceCallingConvention_t<Fs, NewCallingConventionT>...>;
 
 //////////////////////////////////////////////////////////////////////////
 // MemberFunctionReplaceClass_t. If "F" is a non-static member function,
@@ -4947,7 +6182,7 @@ using MemberFunctionReplaceClass_t = FunctionTraitsMemberFunctionReplaceClass_t<
 // type with "NewReturnTypeT"
 //////////////////////////////////////////////////////////////////////////
 template <TRAITS_FUNCTION_C F, typename NewReturnTypeT>
-using ReplaceReturnType_t = FunctionTraitsReplaceReturnType_t<FunctionTraits<F>, NewReturnTypeT>; // Defers to the "FunctionTraits" helper further above
+using ReplaceReturnType_t = STDEXT_TRAITS_PROFILE_HELPER(ReplaceReturnType_t, (F, NewReturnTypeT), FunctionTraitsReplaceReturnType_t<FunctionTraits<F>, NewReturnTypeT>); // Defers to the "FunctionTraits" helper further above
 
 //////////////////////////////////////////////////////////////////////////
 // ReplaceArgs_t. Type alias for "F" after replacing all its existing
@@ -4971,7 +6206,7 @@ using ReplaceReturnType_t = FunctionTraitsReplaceReturnType_t<FunctionTraits<F>,
 // "ReplaceArgs_t" otherwise (it ultimately defers to it).
 //////////////////////////////////////////////////////////////////////////
 template <TRAITS_FUNCTION_C F, typename... NewArgsT>
-using ReplaceArgs_t = FunctionTraitsReplaceArgs_t<FunctionTraits<F>, NewArgsT...>; // Defers to the "FunctionTraits" helper further above
+using ReplaceArgs_t = STDEXT_TRAITS_PROFILE_HELPER(ReplaceArgs_t, (F, NewArgsT...), FunctionTraitsReplaceArgs_t<FunctionTraits<F>, NewArgsT...>); // Defers to the "FunctionTraits" helper further above
 
 //////////////////////////////////////////////////////////////////////////
 // ReplaceArgsTuple_t. Identical to "ReplaceArgs_t" just above except the
@@ -4982,7 +6217,7 @@ using ReplaceArgs_t = FunctionTraitsReplaceArgs_t<FunctionTraits<F>, NewArgsT...
 // it).
 //////////////////////////////////////////////////////////////////////////
 template <TRAITS_FUNCTION_C F, TUPLE_C NewArgsTupleT>
-using ReplaceArgsTuple_t = FunctionTraitsReplaceArgsTuple_t<FunctionTraits<F>, NewArgsTupleT>; // Defers to the "FunctionTraits" helper further above
+using ReplaceArgsTuple_t = STDEXT_TRAITS_PROFILE_HELPER(ReplaceArgsTuple_t, (F, NewArgsTupleT), FunctionTraitsReplaceArgsTuple_t<FunctionTraits<F>, NewArgsTupleT>); // Defers to the "FunctionTraits" helper further above
 
 //////////////////////////////////////////////////////////////////////////
 // ReplaceNthArg_t. Type alias for "F" after replacing its (zero-based)
@@ -5006,1226 +6241,5333 @@ using ReplaceArgsTuple_t = FunctionTraitsReplaceArgsTuple_t<FunctionTraits<F>, N
 // call to "ReplaceNthArg_t".
 //////////////////////////////////////////////////////////////////////////
 template <TRAITS_FUNCTION_C F, std::size_t N, typename NewArgT>
-using ReplaceNthArg_t = FunctionTraitsReplaceNthArg_t<FunctionTraits<F>, N, NewArgT>; // Defer to this in private namespace just above
+using ReplaceNthArg_t = STDEXT_TRAITS_PROFILE_HELPER(ReplaceNthArg_t, (F, N, NewArgT), FunctionTraitsReplaceNthArg_t<FunctionTraits<F>, N, NewArgT>); // Defer to this in private namespace just above
 
-////////////////////////////////////////////////////////////////////////////
-// "IsForEachFunctor" (primary template). Determines if template arg "T" is
-// a functor type whose "operator()" member has the following signature and
-// is also callable in the context of whether "T" is "const" and/or
-// "volatile" and or an lvalue or rvalue (read on):
-//
-//     template <std::size_t I>
-//     bool operator()() [const] [volatile] [&|&&];
-//
-// If "T" contains this function AND it can also be called on an instance
-// of "T" (again, read on), then "T" qualifies as a functor that can be
-// passed to function template "ForEach()" declared later on. Note that the
-// specialization just below does the actual work of checking for this. It
-// simply invokes the above function template in an unevaluated context
-// using "std::declval()" as follows:
-//
-//     T::operator<0>()
-//
-// If the call succeeds then "operator()" must not only exist as a member
-// of "T" with a "bool" return type (we check for this as well), but it's
-// also callable in the context of whether "T" is "const" and/or "volatile"
-// and or an lvalue or rvalue. Note that to qualify as an lvalue for
-// purposes of "IsForEachFunctor", "T" must be an lvalue reference such as
-// "int &". To qualify as an rvalue, "T" must either be a non-reference
-// type such as a plain "int" OR an rvalue reference such as "int &&". The
-// behaviour of what qualifies as an lvalue and rvalue for purposes of
-// using "IsForEachFunctor" therefore follows the usual perfect forwarding
-// rules for function template arguments (where an lvalue reference for "T"
-// means the function's "T &&" argument collapses to an lvalue reference,
-// and a non-reference type or rvalue reference type for "T" means the
-// function's "T &&" argument is an rvalue reference - read up on perfect
-// forwarding for details if you're not already familiar this).
-//
-// As an example, if "T" contains the above "operator()" template but it's
-// not declared with the "const" qualifier but "T" itself is (declared
-// "const"), then calling the function as shown above fails since you can't
-// call a non-const member function using a constant object. The primary
-// template therefore kicks in, inheriting from "std::false_type".
-// Similarly, if "operator()" is declared with the "&&" reference qualifier
-// (rare as this is in practice), but "T" is an lvalue reference, then
-// again, the above call fails since you can't invoke a member function
-// declared with the "&&" (rvalue) reference qualifier using an lvalue
-// reference. Again, the primary template will therefore kick in (once
-// again inheriting from "std::false_type"). The upshot is that not only
-// must "operator()" exist as a member of "T", it must also be callable in
-// the context of "T" itself (whether "T" is "const" and/or "volatile"
-// and/or an lvalue reference, rvalue reference or non-reference - in all
-// cases "operator()" must be properly declared to support calls based on
-// the cv-qualifiers and/or lvalue/rvalue state of "T" itself as described
-// above). If it is then the specialization kicks in and "IsForEachFunctor"
-// therefore inherits from "std::true_type" (meaning "T" is a suitable
-// functor type for passing as the 2nd template arg of function template
-// "ForEach()").
-////////////////////////////////////////////////////////////////////////////
-template <typename T, typename = void>
-struct IsForEachFunctor : std::false_type
-{
-};
+#undef STDEXT_TRAITS_PROFILE_HELPER // Done with this
+#undef STDEXT_TRAITS_PROFILE_EXPAND // Done with this
 
-/////////////////////////////////////////////////////////////////
-// Specialization of "IsForEachFunctor" (primary) template just
-// above. This specialization does all the work. See primary
-// template above for details. Note that calls to "declval(T)"
-// return "T &&" (unless "T" is void - see "declval()" docs) so
-// the following call to this works according to the usual
-// perfect forwarding rules in C++. That is, if "T" is an lvalue
-// reference then "declval()" returns an lvalue reference (due
-// to the C++ reference collapsing rules), otherwise "T" must be
-// an a non-reference or an rvalue reference so "declval"
-// returns an rvalue reference (in either case). In all cases
-// "declval()" therefore returns the same function argument type
-// used in a perfect forwarding function. Such arguments are
-// always of the type "T &&" which resolves to an lvalue
-// reference only if "T" is an lvalue reference (again, due to
-// the C++ reference collapsing rules), or an rvalue reference
-// if "T" is a non-reference or rvalue reference. "declval()"
-// therefore returns the exact same type as a perfectly
-// forwarded argument after plugging in "T" which is what we
-// require here (we're invoking "operator()" on that argument in
-// the following call in an unevaluated context simply to make
-// sure it can be invoked - the primary template kicks in via
-// SFINAE otherwise).
-/////////////////////////////////////////////////////////////////
-template <typename T>
-struct IsForEachFunctor<T,
-                        // See explanation of "declval()" in comments above
-                        std::enable_if_t<std::is_same_v<decltype(std::declval<T>().template operator()<std::size_t(0)>()), bool>>
-                       > : std::true_type
+/////////////////////////////////////////////////////////////////////////////
+// For internal use only (by "RewriteSignature_t" declared just after this
+// namespace)
+/////////////////////////////////////////////////////////////////////////////
+STDEXT_BEGIN_PRIVATE
 {
-};
+    ///////////////////////////////////////////////////////////////////////
+    // Signature. Stores the individual components of a function's type
+    // (as template args identical to those of "FunctionTraitsBase" except
+    // the arg types are passed as a "TypeList"), so that each can be
+    // replaced without building a new function type (let alone a new
+    // "FunctionTraits") every time. The "With" aliases each return a new
+    // "Signature" with the given component replaced, and "Type" is the
+    // function type the components describe (which only "BuildFunctionType"
+    // creates - see this for details). Note that cv and ref-qualifiers are
+    // ignored for free functions (by "BuildFunctionType"), as are the
+    // following (to give the same results as the corresponding
+    // "FunctionTraits" write traits):
+    //
+    //   1) Replacing the class of a free function
+    //   2) Replacing the calling convention of a variadic function (always
+    //      STDEXT_CC_VARIADIC), or of a free function with
+    //      "CallingConvention::Thiscall"
+    //
+    // Lastly, adding variadic args always changes the calling convention to
+    // STDEXT_CC_VARIADIC (again, just like "AddVariadicArgs_t" does).
+    ///////////////////////////////////////////////////////////////////////
+    template <typename ReturnTypeT,
+              typename ClassT,
+              CallingConvention CallingConventionT,
+              bool IsVariadicT,
+              bool IsConstT,
+              bool IsVolatileT,
+              RefQualifier RefQualifierT,
+              bool IsNoexceptT,
+              typename ArgsT>
+    struct Signature
+    {
+        using Args = ArgsT;
 
-/////////////////////////////////////////////////////////
-// Helper variable template for "IsForEachFunctor" just
-// above (with the usual "_v" suffix).
-/////////////////////////////////////////////////////////
-template <typename T>
-inline constexpr bool IsForEachFunctor_v = IsForEachFunctor<T>::value;
+        template <typename NewReturnTypeT>
+        using WithReturnType = Signature<NewReturnTypeT, ClassT, CallingConventionT, IsVariadicT, IsConstT, IsVolatileT, RefQualifierT, IsNoexceptT, ArgsT>;
 
-//////////////////////////////////////////////
-// Concept for above template (see following
-// #defined constant for details)
-//////////////////////////////////////////////
-#if CONCEPTS_SUPPORTED
-    template <typename T>
-    concept ForEachFunctor_c = IsForEachFunctor_v<T>;
+        template <typename NewClassT>
+        using WithClass = Signature<ReturnTypeT,
+                                    std::conditional_t<std::is_void_v<ClassT>, void, NewClassT>,
+                                    CallingConventionT, IsVariadicT, IsConstT, IsVolatileT, RefQualifierT, IsNoexceptT, ArgsT>;
 
-    #define FOR_EACH_FUNCTOR_C StdExt::ForEachFunctor_c
-#else
-    #define STATIC_ASSERT_IS_FOR_EACH_FUNCTOR(T) static_assert(StdExt::IsForEachFunctor_v<T>);
+        template <CallingConvention NewCallingConventionT>
+        using WithCallingConvention = Signature<ReturnTypeT,
+                                                ClassT,
+                                                IsVariadicT || (std::is_void_v<ClassT> && NewCallingConventionT == CallingConvention::Thiscall)
+                                                    ? CallingConventionT
+                                                    : NewCallingConventionT,
+                                                IsVariadicT, IsConstT, IsVolatileT, RefQualifierT, IsNoexceptT, ArgsT>;
 
-    #define FOR_EACH_FUNCTOR_C typename
-#endif
+        template <bool NewIsVariadicT>
+        using WithVariadic = Signature<ReturnTypeT,
+                                       ClassT,
+                                       NewIsVariadicT ? CallingConvention::Variadic : CallingConventionT,
+                                       NewIsVariadicT, IsConstT, IsVolatileT, RefQualifierT, IsNoexceptT, ArgsT>;
 
-/////////////////////////////////////////////////////
-// In C++20 and later we rely on a locally defined
-// lambda declared in function template "ForEach()"
-// instead (that does the same thing as class
-// "ForEachImpl" does below in C++17 or earlier).
-/////////////////////////////////////////////////////
-#if CPP17_OR_EARLIER
-    /////////////////////////////////////////////////////
-    // For internal use only (by "ForEach()" just after
-    // this namespace)
-    /////////////////////////////////////////////////////
-    namespace Private
+        template <bool NewIsConstT>
+        using WithConst = Signature<ReturnTypeT, ClassT, CallingConventionT, IsVariadicT, NewIsConstT, IsVolatileT, RefQualifierT, IsNoexceptT, ArgsT>;
+
+        template <bool NewIsVolatileT>
+        using WithVolatile = Signature<ReturnTypeT, ClassT, CallingConventionT, IsVariadicT, IsConstT, NewIsVolatileT, RefQualifierT, IsNoexceptT, ArgsT>;
+
+        template <RefQualifier NewRefQualifierT>
+        using WithRefQualifier = Signature<ReturnTypeT, ClassT, CallingConventionT, IsVariadicT, IsConstT, IsVolatileT, NewRefQualifierT, IsNoexceptT, ArgsT>;
+
+        template <bool NewIsNoexceptT>
+        using WithNoexcept = Signature<ReturnTypeT, ClassT, CallingConventionT, IsVariadicT, IsConstT, IsVolatileT, RefQualifierT, NewIsNoexceptT, ArgsT>;
+
+        template <typename NewArgsT> // A "TypeList"
+        using WithArgs = Signature<ReturnTypeT, ClassT, CallingConventionT, IsVariadicT, IsConstT, IsVolatileT, RefQualifierT, IsNoexceptT, NewArgsT>;
+
+        using Type = BuildFunctionType_t<ReturnTypeT, ClassT, CallingConventionT, IsVariadicT, IsConstT, IsVolatileT, RefQualifierT, IsNoexceptT, ArgsT>;
+    };
+
+    /////////////////////////////////////////////////////////////////
+    // SignatureOf_t. The "Signature" of function "F", retrieved from
+    // "FunctionTraits<F>" (the only "FunctionTraits" that
+    // "RewriteSignature_t" instantiates)
+    /////////////////////////////////////////////////////////////////
+    template <typename F,
+              typename FunctionTraitsT = FunctionTraits<F>>
+    using SignatureOf_t = Signature<typename FunctionTraitsT::ReturnType,
+                                    typename FunctionTraitsT::Class,
+                                    FunctionTraitsT::CallingConvention,
+                                    FunctionTraitsT::IsVariadic,
+                                    FunctionTraitsT::IsConst,
+                                    FunctionTraitsT::IsVolatile,
+                                    FunctionTraitsT::RefQualifier,
+                                    FunctionTraitsT::IsNoexcept,
+                                    typename FunctionTraitsT::ArgTypeList>;
+
+    ///////////////////////////////////////////////////////////////////
+    // TypeListReplaceNth_t and TupleToTypeList_t. Used by the
+    // "SignatureOps" below to replace the (zero-based) "Nth" type in
+    // "TypeList" "TypeListT" with "NewT" and convert a "std::tuple"
+    // to a "TypeList" respectively
+    ///////////////////////////////////////////////////////////////////
+    template <std::size_t N, typename NewT, typename TypeListT>
+    struct TypeListReplaceNth;
+
+    template <std::size_t N, typename NewT, typename... Ts>
+    struct TypeListReplaceNth<N, NewT, TypeList<Ts...>>
     {
-        /////////////////////////////////////////////////////////////
-        // class ForEachImpl. Private implementation class used by
-        // function template "ForEach()" declared just after this
-        // private namespace. See this for details. Note that in the
-        // following class, "ForEachFunctorT" is always the same
-        // template type passed to "ForEach()", so either "T &" for
-        // the lvalue case or just plain "T" or "T &&" for the rvalue
-        // case (for the "rvalue" case however usually just plain
-        // "T" as per the usual perfect forwarding rules when
-        // invoking such functions via implicit type deduction).
-        ///////////////////////////////////////////////////////////
-        template <std::size_t N, typename ForEachFunctorT>
-        class ForEachImpl
-        {
-            STATIC_ASSERT_IS_FOR_EACH_FUNCTOR(ForEachFunctorT);
+        using Type = ReplaceNthTypeList_t<N, NewT, Ts...>;
+    };
 
-        public:
-            /////////////////////////////////////////////////////////
-            // Constructor. Note that we always pass "functor" by a
-            // "std::forward" reference so "functor" resolves to "&"
-            // or "&&" accordingly
-            /////////////////////////////////////////////////////////
-            constexpr ForEachImpl(ForEachFunctorT&& functor) noexcept
-                ///////////////////////////////////////////////////////////
-                // "std::forward" required when "ForEachFunctorT" is "&&".
-                // Both "functor" and "m_Functor" are therefore "&&" but
-                // "functor" is still an lvalue because it's named (rvalue
-                // references that are named are lvalues!). Therefore
-                // illegal to bind an lvalue (functor) to an rvalue
-                // reference (m_Functor) so "std::forward" is required to
-                // circumvent this (for the "&&" case it returns an "&&"
-                // reference but it's now unnamed so an rvalue and therefore
-                // suitable for initializing "m_Functor")
-                ///////////////////////////////////////////////////////////
-                : m_Functor(std::forward<ForEachFunctorT>(functor))
-            {
-            }
+    template <std::size_t N, typename NewT, typename TypeListT>
+    using TypeListReplaceNth_t = typename TypeListReplaceNth<N, NewT, TypeListT>::Type;
 
-            template <std::size_t I>
-            constexpr bool Process() const
-            {
-                if constexpr (I < N)
-                {
-                    //////////////////////////////////////////////////////////
-                    // Note: Call to "std::forward()" here required to:
-                    // 
-                    //    1) Perfect forward "m_Functor" back to "&" or "&&"
-                    //       accordingly
-                    //    2) In the "&&" case, invoke "operator()" in the
-                    //       context of an rvalue (in particular, can't do
-                    //       this on "m_Functor" directly, without invoking
-                    //       "std::forward", since "m_Functor" is an lvalue
-                    //       so the lvalue version of "operator()" would kick
-                    //       in in the following call instead!!)
-                    //////////////////////////////////////////////////////////
-                    if (std::forward<ForEachFunctorT>(m_Functor).template operator()<I>())
-                    {
-                        ////////////////////////////////////////////////
-                        // Recursive call (in spirit anyway - actually
-                        // stamps out and runs another version of this
-                        // function specialized on I + 1)
-                        ////////////////////////////////////////////////
-                        return Process<I + 1>();
-                    }
-                    else
-                    {
-                        return false;
-                    }
-                }
-                else
-                {
-                    return true;
-                }
-            }
+    //////////////////////////////////////////////////////////////////
+    // TypeListTransform_t. Used by "SignatureOps::TransformArgs" and
+    // "SignatureOps::TransformArgsIf" to replace each type "T" in
+    // "TypeList" "TypeListT" with "TransformT<T>" in a single pack
+    // expansion, but only if "PredicateT<T>::value" is true (types
+    // for which it's false are left as-is)
+    //////////////////////////////////////////////////////////////////
+    template <typename T>
+    struct AlwaysTransformArg : std::true_type
+    {
+    };
 
-        private:
-            /////////////////////////////////////////////////////
-            // Note: Resolves to "&" in the lvalue case or "&&"
-            // otherwise (by the usual C++ reference collapsing
-            // rules - "ForEachFunctorT" is always "T &" in the
-            // former case or either plain "T" or "T &&"
-            // otherwise)
-            /////////////////////////////////////////////////////
-            ForEachFunctorT &&m_Functor;
-        };
-    } // namespace Private
-#endif // #if CPP17_OR_EARLIER
+    template <template <typename> class PredicateT,
+              template <typename> class TransformT,
+              typename TypeListT>
+    struct TypeListTransform;
 
+    template <template <typename> class PredicateT,
+              template <typename> class TransformT,
+              typename... Ts>
+    struct TypeListTransform<PredicateT, TransformT, TypeList<Ts...>>
+    {
+        template <typename T, bool = PredicateT<T>::value>
+        struct TransformIf
+        {
+            using Type = TransformT<T>;
+        };
+
+        template <typename T>
+        struct TransformIf<T, false>
+        {
+            using Type = T;
+        };
+
+        using Type = TypeList<typename TransformIf<Ts>::Type...>;
+    };
+
+    template <template <typename> class PredicateT,
+              template <typename> class TransformT,
+              typename TypeListT>
+    using TypeListTransform_t = typename TypeListTransform<PredicateT, TransformT, TypeListT>::Type;
+
+    template <typename TupleT>
+    struct TupleToTypeList
+    {
+        static_assert(AlwaysFalse<TupleT>, "Invalid template arg \"TupleT\". Must be a \"std::tuple\" containing the arg types you wish to apply");
+    };
+
+    template <typename... Ts>
+    struct TupleToTypeList<std::tuple<Ts...>>
+    {
+        using Type = TypeList<Ts...>;
+    };
+
+    template <typename TupleT>
+    using TupleToTypeList_t = typename TupleToTypeList<TupleT>::Type;
+
+    //////////////////////////////////////////////////////////////////
+    // ApplySignatureOps. Applies each of the given "SignatureOps"
+    // (see these below) to "SignatureT" in left-to-right order
+    //////////////////////////////////////////////////////////////////
+    template <typename SignatureT, typename... OpsT>
+    struct ApplySignatureOps
+    {
+        using Type = SignatureT;
+    };
+
+    template <typename SignatureT, typename OpT, typename... OpsT>
+    struct ApplySignatureOps<SignatureT, OpT, OpsT...> : ApplySignatureOps<typename OpT::template Apply<SignatureT>, OpsT...>
+    {
+    };
+
+    //////////////////////////////////////////////////////////////////
+    // RewriteSignatureImpl. Implements "RewriteSignature_t" (derives
+    // from "FunctionTraitsHelper" only to access its "Migrate"
+    // aliases which migrate the pointer, cv-qualifiers and
+    // reference of "F", if any, to the resulting type exactly as
+    // all other "FunctionTraits" write traits do)
+    //////////////////////////////////////////////////////////////////
+    template <typename F, typename... OpsT>
+    struct RewriteSignatureImpl : FunctionTraitsHelper
+    {
+    private:
+        using FunctionTraitsT = FunctionTraits<F>;
+        using NewF = typename ApplySignatureOps<SignatureOf_t<F, FunctionTraitsT>, OpsT...>::Type::Type;
+
+    public:
+        using Type = std::conditional_t<std::is_void_v<typename FunctionTraitsT::Class>,
+                                        MigratePointerAndRef<typename FunctionTraitsT::Type, NewF>,
+                                        MigrateCvAndRef<typename FunctionTraitsT::Type, NewF>>;
+    };
+} // namespace Private
+STDEXT_END_PRIVATE
+
+/////////////////////////////////////////////////////////////////////////////
+// SignatureOps. The edit operations you can pass to "RewriteSignature_t"
+// (declared just after this namespace). Each one corresponds to (and
+// gives the same result as) the "FunctionTraits" write trait of the same
+// name (seen earlier, without the "_t" suffix), so see the latter for
+// details (e.g., "SignatureOps::ReplaceReturnType<int>" is equivalent to
+// "ReplaceReturnType_t<F, int>"). Each op is just a struct with a nested
+// "Apply" alias template that "RewriteSignature_t" invokes (for internal
+// use only).
+/////////////////////////////////////////////////////////////////////////////
+namespace SignatureOps
+{
+    template <typename NewReturnTypeT>
+    struct ReplaceReturnType
+    {
+        template <typename SignatureT>
+        using Apply = typename SignatureT::template WithReturnType<NewReturnTypeT>;
+    };
+
+    template <typename... NewArgsT>
+    struct ReplaceArgs
+    {
+        template <typename SignatureT>
+        using Apply = typename SignatureT::template WithArgs<TypeList<NewArgsT...>>;
+    };
+
+    template <TUPLE_C NewArgsTupleT>
+    struct ReplaceArgsTuple
+    {
+        template <typename SignatureT>
+        using Apply = typename SignatureT::template WithArgs<Private::TupleToTypeList_t<NewArgsTupleT>>;
+    };
+
+    template <std::size_t N, typename NewArgT>
+    struct ReplaceNthArg
+    {
+        template <typename SignatureT>
+        using Apply = typename SignatureT::template WithArgs<Private::TypeListReplaceNth_t<N, NewArgT, typename SignatureT::Args>>;
+    };
+
+    template <template <typename> class TransformT>
+    struct TransformArgs
+    {
+        template <typename SignatureT>
+        using Apply = typename SignatureT::template WithArgs<Private::TypeListTransform_t<Private::AlwaysTransformArg, TransformT, typename SignatureT::Args>>;
+    };
+
+    template <template <typename> class PredicateT,
+              template <typename> class TransformT>
+    struct TransformArgsIf
+    {
+        template <typename SignatureT>
+        using Apply = typename SignatureT::template WithArgs<Private::TypeListTransform_t<PredicateT, TransformT, typename SignatureT::Args>>;
+    };
+
+    struct AddVariadicArgs
+    {
+        template <typename SignatureT>
+        using Apply = typename SignatureT::template WithVariadic<true>;
+    };
+
+    struct RemoveVariadicArgs
+    {
+        template <typename SignatureT>
+        using Apply = typename SignatureT::template WithVariadic<false>;
+    };
+
+    struct AddNoexcept
+    {
+        template <typename SignatureT>
+        using Apply = typename SignatureT::template WithNoexcept<true>;
+    };
+
+    struct RemoveNoexcept
+    {
+        template <typename SignatureT>
+        using Apply = typename SignatureT::template WithNoexcept<false>;
+    };
+
+    struct MemberFunctionAddConst
+    {
+        template <typename SignatureT>
+        using Apply = typename SignatureT::template WithConst<true>;
+    };
+
+    struct MemberFunctionRemoveConst
+    {
+        template <typename SignatureT>
+        using Apply = typename SignatureT::template WithConst<false>;
+    };
+
+    struct MemberFunctionAddVolatile
+    {
+        template <typename SignatureT>
+        using Apply = typename SignatureT::template WithVolatile<true>;
+    };
+
+    struct MemberFunctionRemoveVolatile
+    {
+        template <typename SignatureT>
+        using Apply = typename SignatureT::template WithVolatile<false>;
+    };
+
+    struct MemberFunctionAddCV
+    {
+        template <typename SignatureT>
+        using Apply = typename SignatureT::template WithConst<true>::template WithVolatile<true>;
+    };
+
+    struct MemberFunctionRemoveCV
+    {
+        template <typename SignatureT>
+        using Apply = typename SignatureT::template WithConst<false>::template WithVolatile<false>;
+    };
+
+    struct MemberFunctionAddLValueReference
+    {
+        template <typename SignatureT>
+        using Apply = typename SignatureT::template WithRefQualifier<RefQualifier::LValue>;
+    };
+
+    struct MemberFunctionAddRValueReference
+    {
+        template <typename SignatureT>
+        using Apply = typename SignatureT::template WithRefQualifier<RefQualifier::RValue>;
+    };
+
+    struct MemberFunctionRemoveReference
+    {
+        template <typename SignatureT>
+        using Apply = typename SignatureT::template WithRefQualifier<RefQualifier::None>;
+    };
+
+    template <CallingConvention NewCallingConventionT>
+    struct ReplaceCallingConvention
+    {
+        template <typename SignatureT>
+        using Apply = typename SignatureT::template WithCallingConvention<NewCallingConventionT>;
+    };
+
+    template <IS_CLASS_C NewClassT>
+    struct MemberFunctionReplaceClass
+    {
+        template <typename SignatureT>
+        using Apply = typename SignatureT::template WithClass<NewClassT>;
+    };
+} // namespace SignatureOps
+
+/////////////////////////////////////////////////////////////////////////////
+// RewriteSignature_t. Type alias for "F" after applying each of the given
+// "SignatureOps" (see these just above) in left-to-right order, so it's
+// equivalent to chaining the corresponding write traits, but much cheaper
+// to compile. Chaining write traits instantiates a new "FunctionTraits"
+// for each intermediate type (and possibly other templates), whereas
+// "RewriteSignature_t" only instantiates "FunctionTraits<F>" itself, and
+// then edits the function's components directly (and only builds the
+// resulting function type once, after all ops are applied). Note that as
+// with all other write traits, the result is a free function type (or a
+// pointer or reference to one, or a reference to such a pointer,
+// mirroring "F") if "F" is a free function, or a pointer to a non-static
+// member function (again, mirroring the cv-qualifiers and reference of
+// "F" if any, and always the case when "F" is a functor, since the ops
+// then target its "operator()").
+//
+//     Example
+//     -------
+//     struct Widget
+//     {
+//         int Process(const std::string &, float) const;
+//     };
+//
+//     ///////////////////////////////////////////////////////////////
+//     // bool (Widget::*)(const std::string &, double) const noexcept
+//     // (the same as chaining "ReplaceReturnType_t",
+//     // "ReplaceNthArg_t" and "AddNoexcept_t").
+//     ///////////////////////////////////////////////////////////////
+//     using F = RewriteSignature_t<decltype(&Widget::Process),
+//                                  SignatureOps::ReplaceReturnType<bool>,
+//                                  SignatureOps::ReplaceNthArg<1, double>,
+//                                  SignatureOps::AddNoexcept>;
+/////////////////////////////////////////////////////////////////////////////
+template <TRAITS_FUNCTION_C F, typename... OpsT>
+using RewriteSignature_t = typename Private::RewriteSignatureImpl<F, OpsT...>::Type;
+
+/////////////////////////////////////////////////////////////////////////////
+// TransformArgs_t. Type alias for "F" after replacing each of its arg types
+// "T" with "TransformT<T>", where "TransformT" is normally an alias template
+// such as "std::decay_t" or "std::add_const_t" (i.e., "TransformT<T>" must
+// be the new arg type itself, not a class with a nested "type" alias, so
+// pass "std::decay_t" for instance, not "std::decay"). Unlike calling
+// "ReplaceNthArg_t" once for each arg, all args are transformed in a single
+// pack expansion, and only "FunctionTraits<F>" is instantiated (the type is
+// rebuilt by "RewriteSignature_t" - see this for details). All other
+// properties of "F" are preserved as usual (calling convention, variadic
+// args, noexcept, cv and ref-qualifiers for non-static member functions,
+// and the pointer, cv-qualifiers and reference of "F" itself if any).
+//
+//     Example
+//     -------
+//     template <typename T>
+//     using ToConstRef = const std::remove_reference_t<T> &;
+//
+//     ////////////////////////////////////////////////////////
+//     // int (*)(const std::string &, const float &) noexcept
+//     ////////////////////////////////////////////////////////
+//     using F = TransformArgs_t<int (*)(std::string, float) noexcept, ToConstRef>;
+/////////////////////////////////////////////////////////////////////////////
+template <TRAITS_FUNCTION_C F,
+          template <typename> class TransformT>
+using TransformArgs_t = RewriteSignature_t<F, SignatureOps::TransformArgs<TransformT>>;
+
+/////////////////////////////////////////////////////////////////////////////
+// TransformArgsIf_t. Same as "TransformArgs_t" just above but only
+// transforms those arg types "T" for which "PredicateT<T>::value" is true
+// (so "PredicateT" is normally a type trait such as "std::is_integral" or
+// "std::is_pointer"). Args for which it's false are left unchanged.
+//
+//     Example
+//     -------
+//     ///////////////////////////////////////////
+//     // void (const char *, long, double, long)
+//     ///////////////////////////////////////////
+//     using F = TransformArgsIf_t<void (const char *, int, double, short),
+//                                 std::is_integral,
+//                                 ToLong>; // template <typename> using ToLong = long;
+/////////////////////////////////////////////////////////////////////////////
+template <TRAITS_FUNCTION_C F,
+          template <typename> class PredicateT,
+          template <typename> class TransformT>
+using TransformArgsIf_t = RewriteSignature_t<F, SignatureOps::TransformArgsIf<PredicateT, TransformT>>;
+
+/////////////////////////////////////////////////////////////////////////////
+// ReferenceKind. Whether a type described by a "TypeDescriptor" (see just
+// below) is an lvalue reference, rvalue reference or not a reference at
+// all.
+/////////////////////////////////////////////////////////////////////////////
+enum class ReferenceKind
+{
+    None,
+    LValue,
+    RValue
+};
+
+/////////////////////////////////////////////////////////////////////////////
+// TypeDescriptor. Describes the return type or an arg type of a function
+// at runtime (see "SignatureDescriptor_v" below). "Size", "Alignment" and
+// "IsTriviallyCopyable" describe the type as it's actually passed (so if
+// "Reference" isn't "ReferenceKind::None" then they describe a pointer,
+// since references are passed that way, which also means the referred-to
+// type need not be complete). They're all zero (false) for "void". "Hash"
+// and "Name" are those of the type itself (references and cv-qualifiers
+// included), as returned by "TypeHash_v" and "TypeNameFixed_v" (so "Name"
+// is null-terminated).
+/////////////////////////////////////////////////////////////////////////////
+struct TypeDescriptor
+{
+    std::size_t Size;
+    std::size_t Alignment;
+    bool IsTriviallyCopyable;
+    ReferenceKind Reference;
+    std::uint64_t Hash;
+    tstring_view Name;
+};
+
+/////////////////////////////////////////////////////////////////////////////
+// SignatureDescriptor. Describes a function's signature at runtime (see
+// "SignatureDescriptor_v" below). "Args" points to "ArgCount" consecutive
+// "TypeDescriptor"s (one for each non-variadic arg, in order), or call
+// "Arg()" to access them (the latter just indexes "Args"). Note that
+// "Args" is never null, even if "ArgCount" is zero.
+/////////////////////////////////////////////////////////////////////////////
+struct SignatureDescriptor
+{
+    TypeDescriptor ReturnType;
+    const TypeDescriptor *Args;
+    std::size_t ArgCount;
+    enum CallingConvention CallingConvention; // Note: Leave the "enum" in place (see "FunctionTraitsBase::CallingConvention")
+    bool IsVariadic;
+
+    constexpr const TypeDescriptor &Arg(std::size_t i) const noexcept
+    {
+        return Args[i];
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////
+// For internal use only (by "SignatureDescriptor_v" declared just after
+// this namespace)
+/////////////////////////////////////////////////////////////////////////////
+STDEXT_BEGIN_PRIVATE
+{
+    template <typename T>
+    inline constexpr TypeDescriptor MakeTypeDescriptor() noexcept
+    {
+        using PassedT = std::conditional_t<std::is_reference_v<T>,
+                                           const void *,
+                                           T>;
+
+        constexpr ReferenceKind Reference = std::is_lvalue_reference_v<T> ? ReferenceKind::LValue
+                                          : std::is_rvalue_reference_v<T> ? ReferenceKind::RValue
+                                          : ReferenceKind::None;
+
+        if constexpr (std::is_void_v<PassedT>)
+        {
+            return TypeDescriptor{0, 0, false, Reference, TypeHash_v<T>, TypeNameFixed_v<T>};
+        }
+        else
+        {
+            return TypeDescriptor{sizeof(PassedT),
+                                  alignof(PassedT),
+                                  std::is_trivially_copyable_v<PassedT>,
+                                  Reference,
+                                  TypeHash_v<T>,
+                                  TypeNameFixed_v<T>};
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////
+    // Static (read-only) array of "TypeDescriptor"s for the "ArgsT"
+    // in "TypeList" "ArgTypeListT". Always has a trailing
+    // (zero-initialized) element so it's never empty (since zero-size
+    // arrays aren't legal), which isn't included in
+    // "SignatureDescriptor::ArgCount".
+    //////////////////////////////////////////////////////////////////
+    template <typename ArgTypeListT>
+    inline constexpr TypeDescriptor ArgDescriptors[1] = {};
+
+    template <typename... ArgsT>
+    inline constexpr TypeDescriptor ArgDescriptors<TypeList<ArgsT...>>[sizeof...(ArgsT) + 1] = {MakeTypeDescriptor<ArgsT>()...,
+                                                                                                TypeDescriptor{}};
+
+    template <typename F,
+              typename FunctionTraitsT = FunctionTraits<F>>
+    inline constexpr SignatureDescriptor MakeSignatureDescriptor() noexcept
+    {
+        using ArgTypeListT = typename FunctionTraitsT::ArgTypeList;
+
+        return SignatureDescriptor{MakeTypeDescriptor<typename FunctionTraitsT::ReturnType>(),
+                                   ArgDescriptors<ArgTypeListT>,
+                                   FunctionTraitsT::ArgCount,
+                                   FunctionTraitsT::CallingConvention,
+                                   FunctionTraitsT::IsVariadic};
+    }
+} // namespace Private
+STDEXT_END_PRIVATE
+
+/////////////////////////////////////////////////////////////////////////////
+// SignatureDescriptor_v. Static (read-only) "SignatureDescriptor" for
+// function "F" (see this above) created entirely at compile time from
+// "FunctionTraits<F>", so it (and the "TypeDescriptor" array that
+// "SignatureDescriptor::Args" points to) is constant-initialized, so no
+// code runs at startup to create it, and it's placed in your program's
+// read-only data (".data.rel.ro" on ELF platforms for instance, since it
+// contains pointers that may require relocation). Intended for
+// runtime code that needs to know the layout of a function's return type
+// and args without any further template instantiation (such as a JIT or
+// an FFI caller that passes args in a buffer). Note that only the
+// non-variadic args are described (see "SignatureDescriptor::IsVariadic"
+// to determine if "F" has variadic args).
+//
+//     Example
+//     -------
+//     int SomeFunc(const std::string &, double);
+//
+//     constexpr const SignatureDescriptor &descriptor = SignatureDescriptor_v<decltype(SomeFunc)>;
+//
+//     for (std::size_t i = 0; i < descriptor.ArgCount; ++i)
+//     {
+//         // Name of each arg type, its size and alignment, etc.
+//         const TypeDescriptor &arg = descriptor.Arg(i);
+//     }
+/////////////////////////////////////////////////////////////////////////////
+template <TRAITS_FUNCTION_C F>
+inline constexpr SignatureDescriptor SignatureDescriptor_v = Private::MakeSignatureDescriptor<F>();
+
+/////////////////////////////////////////////////////////////////////////////
+// For internal use only (by "SignatureName_v" and "FormatSignatureTo()"
+// declared just after this namespace)
+/////////////////////////////////////////////////////////////////////////////
+STDEXT_BEGIN_PRIVATE
+{
+    template <typename OutputIt>
+    inline constexpr OutputIt WriteTo(const tstring_view str, OutputIt out)
+    {
+        for (const TCHAR ch : str)
+        {
+            *out++ = ch;
+        }
+
+        return out;
+    }
+
+    template <typename OutputIt, typename... ArgsT>
+    inline constexpr OutputIt WriteArgNamesTo(TypeList<ArgsT...>, OutputIt out, const bool isVariadic)
+    {
+        bool first = true;
+
+        (((out = WriteTo(first ? _T("") : _T(", "), out)),
+          (out = WriteTo(TypeName_v<ArgsT>, out)),
+          (first = false)), ...);
+
+        if (isVariadic)
+        {
+            out = WriteTo(first ? _T("...") : _T(", ..."), out);
+        }
+
+        return out;
+    }
+
+    //////////////////////////////////////////////////////////////////
+    // CallingConventionKeyword(). Returns the compiler's own keyword
+    // for "callingConvention", i.e., the STDEXT_CC_* macro it's
+    // declared with (as a string), such as "__stdcall" for MSFT or
+    // "__attribute__((stdcall))" for GCC and Clang
+    //////////////////////////////////////////////////////////////////
+    #define STDEXT_CC_KEYWORD_IMPL(CALLING_CONVENTION) #CALLING_CONVENTION
+    #define STDEXT_CC_KEYWORD(CALLING_CONVENTION) _T(STDEXT_CC_KEYWORD_IMPL(CALLING_CONVENTION))
+
+    inline constexpr tstring_view CallingConventionKeyword(const CallingConvention callingConvention) noexcept
+    {
+        tstring_view str;
+
+        switch (callingConvention)
+        {
+            case CallingConvention::Cdecl:
+                str = STDEXT_CC_KEYWORD(STDEXT_CC_CDECL);
+                break;
+            case CallingConvention::Stdcall:
+                str = STDEXT_CC_KEYWORD(STDEXT_CC_STDCALL);
+                break;
+            case CallingConvention::Fastcall:
+                str = STDEXT_CC_KEYWORD(STDEXT_CC_FASTCALL);
+                break;
+            case CallingConvention::Vectorcall:
+                str = STDEXT_CC_KEYWORD(STDEXT_CC_VECTORCALL);
+                break;
+            case CallingConvention::Thiscall:
+                str = STDEXT_CC_KEYWORD(STDEXT_CC_THISCALL);
+                break;
+        #ifdef STDEXT_CC_REGCALL
+            case CallingConvention::Regcall:
+                str = STDEXT_CC_KEYWORD(STDEXT_CC_REGCALL);
+                break;
+        #endif
+            //////////////////////////////////////////////////
+            // Note that "CallingConvention::Variadic" has no
+            // case of its own since it's just an alias for
+            // "Cdecl" (handled above), the calling convention
+            // all variadic functions use, so only a value that
+            // isn't one of the enumerators can land here. We
+            // fall back to "cdecl" then, the compiler's default.
+            //////////////////////////////////////////////////
+            default:
+                str = STDEXT_CC_KEYWORD(STDEXT_CC_CDECL);
+                break;
+        }
+
+        return str;
+    }
+
+    #undef STDEXT_CC_KEYWORD // Done with this
+    #undef STDEXT_CC_KEYWORD_IMPL // Done with this
+
+    //////////////////////////////////////////////////////////////////
+    // WriteSignatureNameTo(). Writes the "SignatureName_v" of "F" to
+    // "out" (see this below for details) and returns the output
+    // iterator just past the last character written.
+    //////////////////////////////////////////////////////////////////
+    template <typename F,
+              typename OutputIt,
+              typename FunctionTraitsT = FunctionTraits<F>>
+    inline constexpr OutputIt WriteSignatureNameTo(OutputIt out)
+    {
+        constexpr enum CallingConvention CallingConventionT = FunctionTraitsT::CallingConvention; // Note: Leave the "enum" in place (see "FunctionTraitsBase::CallingConvention")
+        constexpr bool ShowCallingConvention = !FunctionTraitsT::IsVariadic &&
+                                               CallingConventionT != CallingConvention::Cdecl &&
+                                               (FunctionTraitsT::IsFreeFunction || CallingConventionT != CallingConvention::Thiscall);
+
+        out = WriteTo(TypeName_v<typename FunctionTraitsT::ReturnType>, out);
+        out = WriteTo(_T(" "), out);
+
+        if constexpr (FunctionTraitsT::IsFreeFunction)
+        {
+            if constexpr (ShowCallingConvention)
+            {
+                out = WriteTo(CallingConventionKeyword(CallingConventionT), out);
+                out = WriteTo(_T(" "), out);
+            }
+        }
+        else
+        {
+            out = WriteTo(_T("("), out);
+            if constexpr (ShowCallingConvention)
+            {
+                out = WriteTo(CallingConventionKeyword(CallingConventionT), out);
+                out = WriteTo(_T(" "), out);
+            }
+            out = WriteTo(TypeName_v<typename FunctionTraitsT::Class>, out);
+            out = WriteTo(_T("::*)"), out);
+        }
+
+        out = WriteTo(_T("("), out);
+        out = WriteArgNamesTo(typename FunctionTraitsT::ArgTypeList{}, out, FunctionTraitsT::IsVariadic);
+        out = WriteTo(_T(")"), out);
+
+        if constexpr (FunctionTraitsT::IsConst)
+        {
+            out = WriteTo(_T(" const"), out);
+        }
+        if constexpr (FunctionTraitsT::IsVolatile)
+        {
+            out = WriteTo(_T(" volatile"), out);
+        }
+        if constexpr (FunctionTraitsT::RefQualifier != RefQualifier::None)
+        {
+            out = WriteTo(_T(" "), out);
+            out = WriteTo(RefQualifierToString(FunctionTraitsT::RefQualifier), out);
+        }
+        if constexpr (FunctionTraitsT::IsNoexcept)
+        {
+            out = WriteTo(_T(" noexcept"), out);
+        }
+
+        return out;
+    }
+
+    template <typename F>
+    inline constexpr std::size_t SignatureNameLength = WriteSignatureNameTo<F>(CountingOutputIterator{}).Count;
+
+    template <typename F>
+    inline constexpr FixedString<TCHAR, SignatureNameLength<F>> MakeSignatureName() noexcept
+    {
+        TCHAR buffer[SignatureNameLength<F> + 1] = {};
+        WriteSignatureNameTo<F>(buffer);
+
+        return FixedString<TCHAR, SignatureNameLength<F>>(tstring_view(buffer, SignatureNameLength<F>));
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Static storage for "SignatureName_v" declared just after this
+    // namespace (see this for details)
+    ////////////////////////////////////////////////////////////////
+    template <typename F>
+    inline constexpr FixedString<TCHAR, SignatureNameLength<F>> SignatureNameStorage = MakeSignatureName<F>();
+} // namespace Private
+STDEXT_END_PRIVATE
+
+/////////////////////////////////////////////////////////////////////////////
+// SignatureName_v. Returns the complete (pretty) signature of function "F"
+// as a "tstring_view", built entirely at compile time from the traits of
+// "F" and stored in a static "FixedString" (so it's null-terminated and
+// only the signature itself is stored in your program). The format is
+// "ReturnType (Args)" for free functions, and
+// "ReturnType (Class::*)(Args)" for non-static member functions (and
+// functors, where "Class" is the functor and "Args" are the args of its
+// "operator()"), followed by the cv-qualifiers, ref-qualifier and
+// "noexcept", if any. The calling convention is only included when it's
+// not the default (i.e., not "Cdecl", and also not "Thiscall" for
+// non-static member functions), using the compiler's own keyword for it
+// (such as "int __stdcall (int)" for MSFT, or
+// "int __attribute__((stdcall)) (int)" for GCC and Clang, not the name
+// "CallingConventionName_v" returns). All type names are those
+// "TypeName_v" returns, so they're compiler specific. Note that unlike
+// "FunctionTypeName_v", the result doesn't depend on whether "F" is a
+// pointer or reference (i.e., these are always ignored).
+//
+//     Example
+//     -------
+//     int SomeFunc(const std::string &, double) noexcept;
+//
+//     // "int (const std::string&, double) noexcept" (GCC - type names vary by compiler)
+//     constexpr tstring_view name = SignatureName_v<decltype(SomeFunc)>;
+/////////////////////////////////////////////////////////////////////////////
+template <TRAITS_FUNCTION_C F>
+inline constexpr tstring_view SignatureName_v = Private::SignatureNameStorage<F>;
+
+/////////////////////////////////////////////////////////////////////////////
+// FormatSignatureTo(). Writes "SignatureName_v<F>" (see this just above)
+// to output iterator "out" (e.g., a pointer into your own buffer, which
+// must have room for at least "SignatureName_v<F>.size()" characters, or
+// a "std::back_insert_iterator"), and returns the iterator just past the
+// last character written. No null-terminator is written. Never allocates
+// (the string is built at compile time so this just copies it), so it's
+// suitable for logging on hot paths.
+/////////////////////////////////////////////////////////////////////////////
+template <TRAITS_FUNCTION_C F, typename OutputIt>
+inline constexpr OutputIt FormatSignatureTo(OutputIt out)
+{
+    return Private::WriteTo(SignatureName_v<F>, out);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// For internal use only (by "SignatureDiff" and "IsCallableCompatible_v"
+// declared just after this namespace)
+/////////////////////////////////////////////////////////////////////////////
+STDEXT_BEGIN_PRIVATE
+{
+    //////////////////////////////////////////////////////////////////
+    // IsAbiIdentical_v. True if types "FromT" and "ToT" are passed
+    // (or returned) identically at the machine level, so either can
+    // be reinterpreted as the other without any conversion code. This
+    // is the case if they're the same type ignoring top-level
+    // cv-qualifiers, or both are pointers and/or references (the
+    // latter are passed as pointers) to the same type ignoring its
+    // cv-qualifiers. Note that derived-to-base pointer conversions
+    // aren't considered identical since they may adjust the pointer.
+    //////////////////////////////////////////////////////////////////
+    template <typename T>
+    inline constexpr bool IsPassedAsPointer_v = std::is_reference_v<T> || std::is_pointer_v<std::remove_cv_t<T>>;
+
+    template <typename T>
+    using AbiPointee_t = std::remove_cv_t<std::conditional_t<std::is_reference_v<T>,
+                                                             std::remove_reference_t<T>,
+                                                             std::remove_pointer_t<std::remove_cv_t<T>>>>;
+
+    template <typename FromT, typename ToT>
+    inline constexpr bool IsAbiIdentical_v = std::is_same_v<std::remove_cv_t<FromT>, std::remove_cv_t<ToT>> ||
+                                             (IsPassedAsPointer_v<FromT> &&
+                                              IsPassedAsPointer_v<ToT> &&
+                                              std::is_same_v<AbiPointee_t<FromT>, AbiPointee_t<ToT>>);
+
+    //////////////////////////////////////////////////////////////////
+    // IsReturnConvertible_v. True if a function returning "FromT"
+    // can be called where a function returning "ToT" is expected
+    // (any return type can be discarded if "ToT" is void)
+    //////////////////////////////////////////////////////////////////
+    template <typename FromT, typename ToT>
+    inline constexpr bool IsReturnConvertible_v = std::is_void_v<ToT> || std::is_convertible_v<FromT, ToT>;
+
+    //////////////////////////////////////////////////////////////////
+    // SignatureArgsDiff. Compares the first "N" args in "TypeList"s
+    // "FromArgsT" and "ToArgsT" pairwise, for "SignatureDiff" and
+    // "IsCallableCompatible_v". "Differs" has a trailing (unused)
+    // element so it's never empty (zero-size arrays aren't legal).
+    //////////////////////////////////////////////////////////////////
+    template <typename FromArgsT,
+              typename ToArgsT,
+              typename IndexSequenceT = std::make_index_sequence<std::min(FromArgsT::Size, ToArgsT::Size)>>
+    struct SignatureArgsDiff;
+
+    template <typename FromArgsT,
+              typename ToArgsT,
+              std::size_t... Is>
+    struct SignatureArgsDiff<FromArgsT, ToArgsT, std::index_sequence<Is...>>
+    {
+        static constexpr bool Differs[sizeof...(Is) + 1] = {!std::is_same_v<typename FromArgsT::template Type<Is>,
+                                                                             typename ToArgsT::template Type<Is>>...,
+                                                            true};
+
+        static constexpr bool AnyDiffer = (Differs[Is] || ...);
+
+        static constexpr bool AreAbiIdentical = (IsAbiIdentical_v<typename FromArgsT::template Type<Is>,
+                                                                  typename ToArgsT::template Type<Is>> && ...);
+
+        // Can each "To" arg be passed to the corresponding "From" arg
+        static constexpr bool AreConvertible = (std::is_convertible_v<typename ToArgsT::template Type<Is>,
+                                                                      typename FromArgsT::template Type<Is>> && ...);
+    };
+} // namespace Private
+STDEXT_END_PRIVATE
+
+/////////////////////////////////////////////////////////////////////////////
+// SignatureDiff. Compares the signatures of functions "F1" and "F2" at
+// compile time, reporting which of their components differ (so
+// normally used to check a function against some expected prototype,
+// such as the entry points of a plugin against those its host expects).
+// Any pointer or reference on "F1" or "F2" themselves is ignored (so
+// "int (*)(char)" and "int (&)(char)" have identical signatures for
+// instance), and all members are "static constexpr".
+//
+// "ArgDiffers(i)" is true if the arg types at (zero-based) index "i"
+// differ, or "i" isn't less than the arg count of both functions.
+// "IsIdentical" is true if nothing differs, and "IsAbiIdentical" if the
+// functions are called identically at the machine level, even if they
+// have different types (same calling convention, variadic-ness and arg
+// count, the same class for non-static member functions, and each arg
+// and the return type passed identically, such as "const int *" and
+// "int &" - see "Private::IsAbiIdentical_v"). Note that noexcept and
+// the cv and ref-qualifiers of non-static member functions don't affect
+// "IsAbiIdentical". See "IsCallableCompatible_v" and
+// "IsZeroCostCompatible_v" below as well.
+//
+//     Example
+//     -------
+//     using Diff = SignatureDiff<int (const char *, double), long (const char *, float)>;
+//
+//     static_assert(Diff::ReturnTypeDiffers && !Diff::ArgDiffers(0) && Diff::ArgDiffers(1));
+/////////////////////////////////////////////////////////////////////////////
+template <TRAITS_FUNCTION_C F1,
+          TRAITS_FUNCTION_C F2>
+struct SignatureDiff
+{
+private:
+    using FunctionTraits1 = FunctionTraits<F1>;
+    using FunctionTraits2 = FunctionTraits<F2>;
+    using ArgsDiff = Private::SignatureArgsDiff<typename FunctionTraits1::ArgTypeList, typename FunctionTraits2::ArgTypeList>;
+
+public:
+    static constexpr bool ReturnTypeDiffers = !std::is_same_v<typename FunctionTraits1::ReturnType, typename FunctionTraits2::ReturnType>;
+    static constexpr bool ArgCountDiffers = FunctionTraits1::ArgCount != FunctionTraits2::ArgCount;
+    static constexpr bool AnyArgDiffers = ArgCountDiffers || ArgsDiff::AnyDiffer;
+    static constexpr bool NoexceptDiffers = FunctionTraits1::IsNoexcept != FunctionTraits2::IsNoexcept;
+    static constexpr bool CallingConventionDiffers = FunctionTraits1::CallingConvention != FunctionTraits2::CallingConvention;
+    static constexpr bool VariadicDiffers = FunctionTraits1::IsVariadic != FunctionTraits2::IsVariadic;
+    static constexpr bool ClassDiffers = !std::is_same_v<typename FunctionTraits1::Class, typename FunctionTraits2::Class>;
+    static constexpr bool ConstDiffers = FunctionTraits1::IsConst != FunctionTraits2::IsConst;
+    static constexpr bool VolatileDiffers = FunctionTraits1::IsVolatile != FunctionTraits2::IsVolatile;
+    static constexpr bool RefQualifierDiffers = FunctionTraits1::RefQualifier != FunctionTraits2::RefQualifier;
+
+    static constexpr bool ArgDiffers(const std::size_t i) noexcept
+    {
+        return i >= std::min(FunctionTraits1::ArgCount, FunctionTraits2::ArgCount) || ArgsDiff::Differs[i];
+    }
+
+    static constexpr bool IsIdentical = !ReturnTypeDiffers &&
+                                        !AnyArgDiffers &&
+                                        !NoexceptDiffers &&
+                                        !CallingConventionDiffers &&
+                                        !VariadicDiffers &&
+                                        !ClassDiffers &&
+                                        !ConstDiffers &&
+                                        !VolatileDiffers &&
+                                        !RefQualifierDiffers;
+
+    static constexpr bool IsAbiIdentical = !CallingConventionDiffers &&
+                                           !VariadicDiffers &&
+                                           !ArgCountDiffers &&
+                                           !ClassDiffers &&
+                                           Private::IsAbiIdentical_v<typename FunctionTraits1::ReturnType, typename FunctionTraits2::ReturnType> &&
+                                           ArgsDiff::AreAbiIdentical;
+};
+
+/////////////////////////////////////////////////////////////////////////////
+// For internal use only (by "IsCallableCompatible_v" declared just after
+// this namespace)
+/////////////////////////////////////////////////////////////////////////////
+STDEXT_BEGIN_PRIVATE
+{
+    template <typename FromFunctionTraitsT, typename ToFunctionTraitsT>
+    inline constexpr bool IsObjectCompatible() noexcept
+    {
+        if constexpr (FromFunctionTraitsT::IsFreeFunction || ToFunctionTraitsT::IsFreeFunction)
+        {
+            return FromFunctionTraitsT::IsFreeFunction == ToFunctionTraitsT::IsFreeFunction;
+        }
+        else
+        {
+            return std::is_base_of_v<typename FromFunctionTraitsT::Class, typename ToFunctionTraitsT::Class> &&
+                   (FromFunctionTraitsT::IsConst || !ToFunctionTraitsT::IsConst) &&
+                   (FromFunctionTraitsT::IsVolatile || !ToFunctionTraitsT::IsVolatile) &&
+                   (FromFunctionTraitsT::RefQualifier == RefQualifier::None || FromFunctionTraitsT::RefQualifier == ToFunctionTraitsT::RefQualifier);
+        }
+    }
+
+    template <typename FromFunctionTraitsT, typename ToFunctionTraitsT>
+    inline constexpr bool IsCallableCompatible() noexcept
+    {
+        if constexpr (FromFunctionTraitsT::ArgCount != ToFunctionTraitsT::ArgCount ||
+                      FromFunctionTraitsT::IsVariadic != ToFunctionTraitsT::IsVariadic ||
+                      !IsObjectCompatible<FromFunctionTraitsT, ToFunctionTraitsT>())
+        {
+            return false;
+        }
+        else
+        {
+            return SignatureArgsDiff<typename FromFunctionTraitsT::ArgTypeList, typename ToFunctionTraitsT::ArgTypeList>::AreConvertible &&
+                   IsReturnConvertible_v<typename FromFunctionTraitsT::ReturnType, typename ToFunctionTraitsT::ReturnType> &&
+                   (FromFunctionTraitsT::IsNoexcept || !ToFunctionTraitsT::IsNoexcept);
+        }
+    }
+} // namespace Private
+STDEXT_END_PRIVATE
+
+/////////////////////////////////////////////////////////////////////////////
+// IsCallableCompatible_v. True if a function of type "FromF" can be
+// called through a (thunk with the) signature of "ToF", i.e., both have
+// the same number of args and variadic-ness, each arg of "ToF" is
+// implicitly convertible to the corresponding arg of "FromF", the return
+// type of "FromF" is implicitly convertible to that of "ToF" (or the
+// latter is void), and "FromF" is noexcept if "ToF" is. For non-static
+// member functions, the class of "FromF" must also be the same as (or a
+// base of) the class of "ToF", and its cv and ref-qualifiers must accept
+// an object qualified as "ToF" specifies. Calling conventions are
+// ignored (a thunk can bridge them). Use "IsZeroCostCompatible_v" just
+// below to determine if no thunk is required at all.
+/////////////////////////////////////////////////////////////////////////////
+template <TRAITS_FUNCTION_C FromF,
+          TRAITS_FUNCTION_C ToF>
+inline constexpr bool IsCallableCompatible_v = Private::IsCallableCompatible<FunctionTraits<FromF>, FunctionTraits<ToF>>();
+
+/////////////////////////////////////////////////////////////////////////////
+// IsZeroCostCompatible_v. True if "IsCallableCompatible_v<FromF, ToF>" is
+// true and the two are also ABI identical (see
+// "SignatureDiff::IsAbiIdentical"), so a pointer to a "FromF" can simply
+// be cast to a pointer to a "ToF" and called (no conversion thunk is
+// required). Note that formally, calling a function through a pointer
+// to a different function type is undefined behavior in C++ (unless the
+// types are identical), though it's well-defined at the ABI level in
+// this case (which is what plugin loaders normally rely on).
+/////////////////////////////////////////////////////////////////////////////
+template <TRAITS_FUNCTION_C FromF,
+          TRAITS_FUNCTION_C ToF>
+inline constexpr bool IsZeroCostCompatible_v = IsCallableCompatible_v<FromF, ToF> && SignatureDiff<FromF, ToF>::IsAbiIdentical;
+
+/////////////////////////////////////////////////////////////////////////////
+// For internal use only (by "OverloadTraits" declared just after this
+// namespace)
+/////////////////////////////////////////////////////////////////////////////
+STDEXT_BEGIN_PRIVATE
+{
+    //////////////////////////////////////////////////////////////////
+    // IsOperatorCallOverload. Inherits from "std::true_type" if
+    // functor "ClassT" has an "operator()" (overload or
+    // specialization) whose type is exactly "MemberFunctionPtrT",
+    // which taking its address resolves exactly as the compiler does
+    // when the address of an overloaded function is converted to a
+    // specific (target) type (deducing the template args of any
+    // "operator()" template, such as a generic lambda's, from
+    // "MemberFunctionPtrT"). Note that the address is passed to
+    // "AcceptOperatorCall()" (an implicit conversion) rather than
+    // "static_cast" to "MemberFunctionPtrT", since some compilers (GCC
+    // at this writing) let the latter add "noexcept" to a function
+    // that isn't.
+    //////////////////////////////////////////////////////////////////
+    template <typename MemberFunctionPtrT>
+    void AcceptOperatorCall(MemberFunctionPtrT) noexcept; // Never defined (only used in unevaluated contexts)
+
+    template <typename MemberFunctionPtrT, typename ClassT, typename = void>
+    struct IsOperatorCallOverload : std::false_type
+    {
+    };
+
+    template <typename MemberFunctionPtrT, typename ClassT>
+    struct IsOperatorCallOverload<MemberFunctionPtrT,
+                                  ClassT,
+                                  std::void_t<decltype(AcceptOperatorCall<MemberFunctionPtrT>(&ClassT::operator()))>> : std::true_type
+    {
+    };
+
+    template <typename... TypeListsT>
+    struct TypeListConcat;
+
+    template <>
+    struct TypeListConcat<>
+    {
+        using Type = TypeList<>;
+    };
+
+    template <typename... Ts>
+    struct TypeListConcat<TypeList<Ts...>>
+    {
+        using Type = TypeList<Ts...>;
+    };
+
+    template <typename... Ts, typename... Us, typename... TypeListsT>
+    struct TypeListConcat<TypeList<Ts...>, TypeList<Us...>, TypeListsT...> : TypeListConcat<TypeList<Ts..., Us...>, TypeListsT...>
+    {
+    };
+
+    template <typename... TypeListsT>
+    using TypeListConcat_t = typename TypeListConcat<TypeListsT...>::Type;
+
+    template <bool IsConstT, bool IsVolatileT, RefQualifier RefQualifierT>
+    struct OverloadQualifiers
+    {
+        static constexpr bool IsConst = IsConstT;
+        static constexpr bool IsVolatile = IsVolatileT;
+        static constexpr enum RefQualifier RefQualifier = RefQualifierT; // Note: Leave the "enum" in place (see "FunctionTraitsBase::CallingConvention")
+    };
+
+    //////////////////////////////////////////////////////////////////
+    // OverloadQualifierCandidates_t. "TypeList" of the
+    // "OverloadQualifiers" an "operator()" overload may have to be
+    // callable on an object of type "std::declval<F>()", in the
+    // order overload resolution prefers them (first the object's
+    // own cv-qualifiers then more qualified ones, and for each,
+    // "&&" before no ref-qualifier for rvalues, or "&" for lvalues,
+    // followed by "const &" for rvalues when applicable). Note that
+    // an "operator()" with a ref-qualifier can't be overloaded with
+    // one that has none (for the same args), so the order of the
+    // latter two never matters.
+    //////////////////////////////////////////////////////////////////
+    template <bool IsLValueT, bool IsConstT, bool IsVolatileT>
+    using OverloadRefCandidates_t = std::conditional_t<IsLValueT,
+                                                       TypeList<OverloadQualifiers<IsConstT, IsVolatileT, RefQualifier::LValue>,
+                                                                OverloadQualifiers<IsConstT, IsVolatileT, RefQualifier::None>>,
+                                                       std::conditional_t<IsConstT && !IsVolatileT,
+                                                                          TypeList<OverloadQualifiers<IsConstT, IsVolatileT, RefQualifier::RValue>,
+                                                                                   OverloadQualifiers<IsConstT, IsVolatileT, RefQualifier::None>,
+                                                                                   OverloadQualifiers<IsConstT, IsVolatileT, RefQualifier::LValue>>,
+                                                                          TypeList<OverloadQualifiers<IsConstT, IsVolatileT, RefQualifier::RValue>,
+                                                                                   OverloadQualifiers<IsConstT, IsVolatileT, RefQualifier::None>>>>;
+
+    template <typename F,
+              bool IsLValueT = std::is_lvalue_reference_v<F>,
+              bool IsConstT = std::is_const_v<std::remove_reference_t<F>>,
+              bool IsVolatileT = std::is_volatile_v<std::remove_reference_t<F>>>
+    using OverloadQualifierCandidates_t = TypeListConcat_t<OverloadRefCandidates_t<IsLValueT, IsConstT, IsVolatileT>,
+                                                           std::conditional_t<!IsConstT, OverloadRefCandidates_t<IsLValueT, true, IsVolatileT>, TypeList<>>,
+                                                           std::conditional_t<!IsVolatileT, OverloadRefCandidates_t<IsLValueT, IsConstT, true>, TypeList<>>,
+                                                           std::conditional_t<!IsConstT && !IsVolatileT, OverloadRefCandidates_t<IsLValueT, true, true>, TypeList<>>>;
+
+    //////////////////////////////////////////////////////////////////
+    // OverloadParamCandidates_t. "TypeList" of the candidate
+    // parameter lists (each a "TypeList") of the "operator()" that
+    // a call with args "ArgsT" may resolve to, in the order they're
+    // tried. Each parameter is normally declared by value, as a
+    // forwarding reference ("auto &&" in a generic lambda, which the
+    // call deduces as "ArgsT &&", or for non-template overloads, an
+    // rvalue or lvalue reference), or "const &". Every combination of
+    // these (one per "Mask" digit in base 3, see
+    // "OverloadParamForm_t") is tried first for up to
+    // "MaxMixedOverloadParams" args (only the three uniform
+    // combinations otherwise), followed by "ArgsT" exactly, then
+    // "ArgsT &" (uniformly).
+    //
+    // The order of the forms matters for templates, since a given
+    // target type can be deduced by more than one form (so the first
+    // form that accepts it may not be the one the call deduces). Only
+    // a by-value parameter accepts a non-reference type, so by-value
+    // is tried first. Of the remaining forms only a forwarding
+    // reference accepts "ArgsT &&" when "ArgsT" is an rvalue, and for
+    // lvalues, every form that accepts "ArgsT &&" (which is then
+    // "ArgsT &") deduces exactly that from the call as well, so it's
+    // tried next. "const &" (which "auto &&" and "auto &" also accept)
+    // is therefore tried last. Since each parameter of a template is
+    // deduced independently, the first combination that matches is
+    // the one whose forms are each the first to match (i.e., the
+    // specialization the call deduces).
+    //////////////////////////////////////////////////////////////////
+    inline constexpr std::size_t MaxMixedOverloadParams = 4;
+
+    inline constexpr std::size_t OverloadParamFormCount = 3;
+
+    template <std::size_t FormT, typename ArgT>
+    using OverloadParamForm_t = std::conditional_t<FormT == 0,
+                                                   std::decay_t<ArgT>, // By value
+                                                   std::conditional_t<FormT == 1,
+                                                                      ArgT &&, // Forwarding reference
+                                                                      const std::remove_reference_t<ArgT> &>>;
+
+    inline constexpr std::size_t OverloadParamFormDivisor(std::size_t i) noexcept
+    {
+        std::size_t divisor = 1;
+        for (; i != 0; --i)
+        {
+            divisor *= OverloadParamFormCount;
+        }
+
+        return divisor;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    // Parameter list for "Mask", where the form of each parameter
+    // "I" is digit "I" of "Mask" in base 3, or just "Mask" itself
+    // for all parameters if "IsUniformT" is true
+    ///////////////////////////////////////////////////////////////
+    template <bool IsUniformT, std::size_t Mask, typename IndexSequenceT, typename... ArgsT>
+    struct OverloadParamsForMask;
+
+    template <bool IsUniformT, std::size_t Mask, std::size_t... Is, typename... ArgsT>
+    struct OverloadParamsForMask<IsUniformT, Mask, std::index_sequence<Is...>, ArgsT...>
+    {
+        using Type = TypeList<OverloadParamForm_t<IsUniformT ? Mask : (Mask / OverloadParamFormDivisor(Is)) % OverloadParamFormCount,
+                                                  ArgsT>...>;
+    };
+
+    template <bool IsUniformT, typename MaskSequenceT, typename... ArgsT>
+    struct OverloadParamCandidates;
+
+    template <bool IsUniformT, std::size_t... Masks, typename... ArgsT>
+    struct OverloadParamCandidates<IsUniformT, std::index_sequence<Masks...>, ArgsT...>
+    {
+        using Type = TypeList<typename OverloadParamsForMask<IsUniformT, Masks, std::index_sequence_for<ArgsT...>, ArgsT...>::Type...,
+                              TypeList<ArgsT...>,
+                              TypeList<std::add_lvalue_reference_t<ArgsT>...>>;
+    };
+
+    template <typename... ArgsT>
+    using OverloadParamCandidates_t = typename OverloadParamCandidates<(sizeof...(ArgsT) > MaxMixedOverloadParams),
+                                                                      std::make_index_sequence<(sizeof...(ArgsT) <= MaxMixedOverloadParams) ? OverloadParamFormDivisor(sizeof...(ArgsT))
+                                                                                                                                            : OverloadParamFormCount>, // Uniform forms only
+                                                                      ArgsT...>::Type;
+
+    ///////////////////////////////////////////////////////////////////
+    // Calling conventions an "operator()" may have. Normally just
+    // "CallingConvention::Cdecl" (the default for non-static member
+    // functions on most platforms), but also
+    // "CallingConvention::Thiscall" when the compiler doesn't replace
+    // it with the former (the default on 32-bit MSFT platforms)
+    ///////////////////////////////////////////////////////////////////
+    template <CallingConvention... CallingConventionsT>
+    struct OverloadCallingConventions
+    {
+    };
+
+    using OverloadCallingConventionCandidates = std::conditional_t<CallingConventionReplacedWithCdecl<CallingConvention::Thiscall, false>(),
+                                                                   OverloadCallingConventions<CallingConvention::Cdecl>,
+                                                                   OverloadCallingConventions<CallingConvention::Thiscall, CallingConvention::Cdecl>>;
+
+    ///////////////////////////////////////////////////////////////////
+    // OverloadProbe. "std::true_type" if "ClassT" has an "operator()"
+    // of type "Type" (see "IsOperatorCallOverload"). The probes below
+    // are combined with "std::disjunction" which stops at the first
+    // match, so only the probes up to (and including) the match are
+    // ever instantiated.
+    ///////////////////////////////////////////////////////////////////
+    template <typename ReturnTypeT,
+              typename ClassT,
+              typename ParamsT,
+              typename QualifiersT,
+              bool IsNoexceptT,
+              CallingConvention CallingConventionT>
+    struct OverloadProbe;
+
+    template <typename ReturnTypeT,
+              typename ClassT,
+              typename... ParamsT,
+              typename QualifiersT,
+              bool IsNoexceptT,
+              CallingConvention CallingConventionT>
+    struct OverloadProbe<ReturnTypeT, ClassT, TypeList<ParamsT...>, QualifiersT, IsNoexceptT, CallingConventionT>
+        : IsOperatorCallOverload<typename MemberFunctionTypeBuilder<CallingConventionT,
+                                                                    false,
+                                                                    QualifiersT::IsConst,
+                                                                    QualifiersT::IsVolatile,
+                                                                    QualifiersT::RefQualifier>::template Type<ReturnTypeT, ClassT, IsNoexceptT, ParamsT...>,
+                                 ClassT>
+    {
+        using Type = typename MemberFunctionTypeBuilder<CallingConventionT,
+                                                        false,
+                                                        QualifiersT::IsConst,
+                                                        QualifiersT::IsVolatile,
+                                                        QualifiersT::RefQualifier>::template Type<ReturnTypeT, ClassT, IsNoexceptT, ParamsT...>;
+    };
+
+    template <typename ReturnTypeT, typename ClassT, typename ParamsT, typename QualifiersT, typename CallingConventionsT>
+    struct OverloadProbeQualifiers;
+
+    template <typename ReturnTypeT, typename ClassT, typename ParamsT, typename QualifiersT, CallingConvention... CallingConventionsT>
+    struct OverloadProbeQualifiers<ReturnTypeT, ClassT, ParamsT, QualifiersT, OverloadCallingConventions<CallingConventionsT...>>
+        : std::disjunction<OverloadProbe<ReturnTypeT, ClassT, ParamsT, QualifiersT, true, CallingConventionsT>...,
+                           OverloadProbe<ReturnTypeT, ClassT, ParamsT, QualifiersT, false, CallingConventionsT>...>
+    {
+    };
+
+    template <typename ReturnTypeT, typename ClassT, typename ParamsT, typename QualifiersListT>
+    struct OverloadProbeParams;
+
+    template <typename ReturnTypeT, typename ClassT, typename ParamsT, typename... QualifiersT>
+    struct OverloadProbeParams<ReturnTypeT, ClassT, ParamsT, TypeList<QualifiersT...>>
+        : std::disjunction<OverloadProbeQualifiers<ReturnTypeT, ClassT, ParamsT, QualifiersT, OverloadCallingConventionCandidates>...>
+    {
+    };
+
+    struct NoOverloadMatch : std::true_type
+    {
+        using Type = void;
+    };
+
+    template <typename ReturnTypeT, typename ClassT, typename ParamsListT, typename QualifiersListT>
+    struct ResolveOverload;
+
+    template <typename ReturnTypeT, typename ClassT, typename... ParamsT, typename QualifiersListT>
+    struct ResolveOverload<ReturnTypeT, ClassT, TypeList<ParamsT...>, QualifiersListT>
+        : std::disjunction<OverloadProbeParams<ReturnTypeT, ClassT, ParamsT, QualifiersListT>...,
+                           NoOverloadMatch>
+    {
+    };
+
+    template <typename ClassT>
+    struct FunctorOperatorCall
+    {
+        using Type = decltype(&ClassT::operator());
+    };
+
+    ///////////////////////////////////////////////////////////////////
+    // OverloadType. Implements "OverloadType_t" declared after this
+    // namespace (see this for details)
+    ///////////////////////////////////////////////////////////////////
+    template <typename F, typename... ArgsT>
+    struct OverloadType
+    {
+        static_assert(std::is_class_v<RemoveCvRef<F>>,
+                      "\"OverloadTraits\" and \"OverloadType_t\" require a class (functor) type for \"F\" (optionally "
+                      "cv-qualified and/or a reference, which determines which \"operator()\" overloads apply)");
+        static_assert(std::is_invocable_v<F, ArgsT...>,
+                      "\"F\" can't be invoked with the given \"ArgsT\" (no viable \"operator()\")");
+
+        /////////////////////////////////////////////////////////
+        // If "F" has a single (non-template) "operator()" then a
+        // call can only resolve to it (regardless of "ArgsT",
+        // which therefore need only be convertible to its
+        // parameters), so no candidates need to be tried
+        /////////////////////////////////////////////////////////
+        using Type = typename std::conditional_t<IsFunctor_v<RemoveCvRef<F>>,
+                                                 FunctorOperatorCall<RemoveCvRef<F>>,
+                                                 ResolveOverload<decltype(std::declval<F>()(std::declval<ArgsT>()...)),
+                                                                 RemoveCvRef<F>,
+                                                                 OverloadParamCandidates_t<ArgsT...>,
+                                                                 OverloadQualifierCandidates_t<F>>>::Type;
+
+        static_assert(!std::is_void_v<Type>,
+                      "Unable to determine which \"operator()\" \"F\" resolves to when called with the given \"ArgsT\". "
+                      "Its parameters must be declared by value, as \"ArgsT &&\" or \"const &\", or exactly as \"ArgsT\" "
+                      "(or \"ArgsT &\" - see \"Private::OverloadParamCandidates_t\"). Take the address of the target "
+                      "overload and cast it to its exact member function pointer type instead.");
+    };
+} // namespace Private
+STDEXT_END_PRIVATE
+
+/////////////////////////////////////////////////////////////////////////////
+// OverloadType_t. Type alias for the pointer to the (non-static) member
+// function "operator()" of functor "F" that a call to an object of type
+// "F" with args of types "ArgsT" resolves to (such as a
+// "std::declval<F>()(std::declval<ArgsT>()...)" expression). Unlike
+// "FunctionTraits", "F" can therefore have any number of "operator()"
+// overloads and/or templates, such as a generic lambda (in which case the
+// result is the specialization the call deduces), or an "overloaded"
+// functor combining several lambdas or free functions. "F" may be
+// cv-qualified and/or a reference (to an lvalue or rvalue), which
+// determines which overloads apply (just as it does for the call
+// itself). Note that "F" can't be a free function (overload sets of free
+// functions can't be passed as types), so wrap the latter in a functor
+// first.
+//
+// Note that C++ provides no direct way to retrieve the function a call
+// resolves to, so each candidate member function pointer type is tried in
+// turn (the return type is always that of the call itself, and the
+// cv-qualifiers, ref-qualifier, "noexcept" and calling convention are
+// tried in the order overload resolution would prefer, just as the
+// parameter types are - see "Private::OverloadParamCandidates_t"). The
+// first such type that the address of "F::operator()" converts to is the
+// result. This reliably identifies overloads whose parameters are
+// declared by value, as forwarding references (such as "auto &&" in a
+// generic lambda) or "const &" (which is by far the norm), in any
+// combination (for up to 4 args), or exactly as "ArgsT". Note that if
+// "F" has a single (non-template) "operator()" then it's always the
+// result (no candidates are tried), so "ArgsT" need only be convertible
+// to its parameters in this case. A "static_assert"
+// occurs otherwise (in which case take the address of the overload
+// yourself and cast it to its exact type, then pass the latter to
+// "FunctionTraits" instead).
+/////////////////////////////////////////////////////////////////////////////
+template <typename F, typename... ArgsT>
+using OverloadType_t = typename Private::OverloadType<F, ArgsT...>::Type;
+
+/////////////////////////////////////////////////////////////////////////////
+// OverloadTraits. "FunctionTraits" for the "operator()" of functor "F"
+// that a call with args of types "ArgsT" resolves to (i.e.,
+// "FunctionTraits<OverloadType_t<F, ArgsT...>>" - see "OverloadType_t" just
+// above). Since "OverloadTraits" is a class template, resolving the
+// overload only occurs once for each "F" and "ArgsT" combination
+// (repeated uses, such as dispatch tables querying the same overloads,
+// simply reuse the instantiated class).
+//
+//     Example
+//     -------
+//     struct Handler
+//     {
+//         void operator()(int) const;
+//         bool operator()(const std::string &) const;
+//     };
+//
+//     using Traits = OverloadTraits<Handler, std::string>;
+//
+//     // bool
+//     using R = Traits::ReturnType;
+//
+//     // "bool (Handler::*)(const std::string &) const"
+//     using F = Traits::Type;
+/////////////////////////////////////////////////////////////////////////////
+template <typename F, typename... ArgsT>
+struct OverloadTraits : FunctionTraits<OverloadType_t<F, ArgsT...>>
+{
+};
+
+///////////////////////////////////////////////////////////////////////////
+// For internal use only (by "ValueTraits" just after this namespace)
+///////////////////////////////////////////////////////////////////////////
+STDEXT_BEGIN_PRIVATE
+{
+    ///////////////////////////////////////////////////////////////////////
+    // ValueTraitsObject_t. Type of the object that "ValueTraits::Invoke()"
+    // takes as its first arg when "F" is a pointer to a non-static member
+    // function, namely a reference to the function's class with the same
+    // cv-qualifiers as the function itself, and an rvalue reference if
+    // the function is "&&" qualified (or an lvalue reference otherwise).
+    ///////////////////////////////////////////////////////////////////////
+    template <typename FunctionTraitsT,
+              typename ClassT = typename FunctionTraitsT::Class,
+              typename CvClassT = std::conditional_t<FunctionTraitsT::IsVolatile,
+                                                     std::conditional_t<FunctionTraitsT::IsConst, const volatile ClassT, volatile ClassT>,
+                                                     std::conditional_t<FunctionTraitsT::IsConst, const ClassT, ClassT>>>
+    using ValueTraitsObject_t = std::conditional_t<FunctionTraitsT::RefQualifier == RefQualifier::RValue,
+                                                   CvClassT &&,
+                                                   CvClassT &>;
+
+    ///////////////////////////////////////////////////////////////////////
+    // ValueTraitsParams_t. The parameter types of "ValueTraits::Invoke()"
+    // (as a "TypeList"), i.e., the (non-variadic) arg types of "F" itself,
+    // preceded by "ValueTraitsObject_t" just above if "F" is a pointer to
+    // a non-static member function
+    ///////////////////////////////////////////////////////////////////////
+    template <typename FunctionTraitsT,
+              bool IsNonStaticMemberT = FunctionTraitsT::IsMemberFunction && !FunctionTraitsT::IsFunctor>
+    struct ValueTraitsParams
+    {
+        using Type = typename FunctionTraitsT::ArgTypeList;
+    };
+
+    template <typename FunctionTraitsT>
+    struct ValueTraitsParams<FunctionTraitsT, true>
+    {
+        using Type = TypeListConcat_t<TypeList<ValueTraitsObject_t<FunctionTraitsT>>,
+                                      typename FunctionTraitsT::ArgTypeList>;
+    };
+
+    template <typename FunctionTraitsT>
+    using ValueTraitsParams_t = typename ValueTraitsParams<FunctionTraitsT>::Type;
+
+    ///////////////////////////////////////////////////////////////////////
+    // ValueTraitsCall (primary template). Calls "F" (a pointer to a free
+    // function or a functor object) directly with the given args. The
+    // partial specialization just below does the same for pointers to
+    // non-static member functions (where the first arg is the object to
+    // invoke it on).
+    ///////////////////////////////////////////////////////////////////////
+    template <auto F,
+              bool IsNonStaticMemberT>
+    struct ValueTraitsCall
+    {
+        template <typename... ArgsT>
+        static constexpr decltype(auto) Call(ArgsT &&... args)
+        {
+            return F(std::forward<ArgsT>(args)...);
+        }
+    };
+
+    template <auto F>
+    struct ValueTraitsCall<F, true>
+    {
+        template <typename ObjectT,
+                  typename... ArgsT>
+        static constexpr decltype(auto) Call(ObjectT &&object, ArgsT &&... args)
+        {
+            return (std::forward<ObjectT>(object).*F)(std::forward<ArgsT>(args)...);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////
+    // ValueTraitsInvoker (primary template). Implements the "Invoke()"
+    // and "operator()" members of "ValueTraits" (which derives from
+    // this), specialized on "ValueTraitsParams_t" (see this for details)
+    // so that the exact parameter types of "Invoke()" are available as a
+    // parameter pack. The primary template is never used, only the
+    // partial specializations just below are (the second one for
+    // variadic functions, whose "Invoke()" also takes any variadic args
+    // by forwarding reference).
+    ///////////////////////////////////////////////////////////////////////
+    template <auto F,
+              typename FunctionTraitsT,
+              typename ParamsTypeListT = ValueTraitsParams_t<FunctionTraitsT>,
+              bool IsVariadicT = FunctionTraitsT::IsVariadic>
+    struct ValueTraitsInvoker;
+
+    template <auto F,
+              typename FunctionTraitsT,
+              typename... ParamsT>
+    struct ValueTraitsInvoker<F, FunctionTraitsT, TypeList<ParamsT...>, false>
+    {
+        static constexpr typename FunctionTraitsT::ReturnType Invoke(ParamsT... params) noexcept(FunctionTraitsT::IsNoexcept)
+        {
+            return ValueTraitsCall<F, FunctionTraitsT::IsMemberFunction && !FunctionTraitsT::IsFunctor>::Call(std::forward<ParamsT>(params)...);
+        }
+
+        constexpr typename FunctionTraitsT::ReturnType operator()(ParamsT... params) const noexcept(FunctionTraitsT::IsNoexcept)
+        {
+            return Invoke(std::forward<ParamsT>(params)...);
+        }
+    };
+
+    template <auto F,
+              typename FunctionTraitsT,
+              typename... ParamsT>
+    struct ValueTraitsInvoker<F, FunctionTraitsT, TypeList<ParamsT...>, true>
+    {
+        template <typename... VariadicArgsT>
+        static constexpr typename FunctionTraitsT::ReturnType Invoke(ParamsT... params, VariadicArgsT &&... variadicArgs) noexcept(FunctionTraitsT::IsNoexcept)
+        {
+            return ValueTraitsCall<F, FunctionTraitsT::IsMemberFunction && !FunctionTraitsT::IsFunctor>::Call(std::forward<ParamsT>(params)...,
+                                                                                                              std::forward<VariadicArgsT>(variadicArgs)...);
+        }
+
+        template <typename... VariadicArgsT>
+        constexpr typename FunctionTraitsT::ReturnType operator()(ParamsT... params, VariadicArgsT &&... variadicArgs) const noexcept(FunctionTraitsT::IsNoexcept)
+        {
+            return Invoke(std::forward<ParamsT>(params)..., std::forward<VariadicArgsT>(variadicArgs)...);
+        }
+    };
+} // namespace Private
+STDEXT_END_PRIVATE
+
+/////////////////////////////////////////////////////////////////////////////
+// ValueTraits. "FunctionTraits" for a specific function instead of a
+// function type, where "F" is a (compile-time constant) pointer to a free
+// function, a pointer to a non-static member function, or (C++20 or later)
+// a functor object such as a captureless lambda. Derives from
+// "FunctionTraits<decltype(F)>" so all its members are available, and
+// adds the following:
+//
+//     // "F" itself
+//     static constexpr auto Value = F;
+//
+//     // Calls "F" directly (never through a pointer)
+//     static constexpr ReturnType Invoke(ArgsT... args) noexcept(IsNoexcept);
+//
+//     // Same as "Invoke()" (so "ValueTraits<F>" is a callable type itself)
+//     constexpr ReturnType operator()(ArgsT... args) const noexcept(IsNoexcept);
+//
+// where "ArgsT" are the exact (non-variadic) arg types of "F" (as given
+// by "ArgTypeList"), preceded by the object to invoke "F" on if it's a
+// non-static member function (a reference to "Class" with the same
+// cv-qualifiers as "F", and an rvalue reference if "F" is "&&" qualified
+// or an lvalue reference otherwise). If "F" is variadic then both
+// functions are templates that also take the variadic args (by
+// forwarding reference).
+//
+// Since the target is part of the type itself, "ValueTraits<F>" is an
+// empty (stateless) callable whose call to "F" the compiler can always
+// inline (unlike a call through a stored function pointer, which it can
+// only inline if it can prove what the pointer points to). Passing a
+// "ValueTraits<F>" wherever a callable is expected (such as to "Delegate",
+// whose buffer it occupies no space in, or "InvokeWithDecoder()") is
+// therefore the cheapest way to bind a function that's known at compile
+// time ("DispatchTable" relies on this to call each of its handlers
+// directly from their trampolines). Note that "&ValueTraits<F>::Invoke"
+// is also a plain function pointer with the same signature as "F"
+// (except for non-static member functions, where the object becomes the
+// first arg, and its calling convention, which is always the default).
+//
+//     Example
+//     -------
+//     int Add(int a, int b) noexcept;
+//
+//     using AddTraits = ValueTraits<&Add>;
+//
+//     // "int (*)(int, int) noexcept" (as for "FunctionTraits")
+//     using F = AddTraits::Type;
+//
+//     // Calls "Add()" directly
+//     const int sum = AddTraits::Invoke(1, 2);
+//
+//     // Stateless, zero-overhead callable bound to "Add()"
+//     constexpr AddTraits add;
+//     const int sum2 = add(3, 4);
+/////////////////////////////////////////////////////////////////////////////
+template <auto F>
+struct ValueTraits : FunctionTraits<decltype(F)>,
+                     Private::ValueTraitsInvoker<F, FunctionTraits<decltype(F)>>
+{
+    static_assert(!FunctionTraits<decltype(F)>::IsFunctor || FunctionTraits<decltype(F)>::IsConst,
+                  "\"F\" is a functor whose \"operator()\" isn't \"const\" (so it can't be called on "
+                  "\"F\" itself, a template parameter object, which is always \"const\")");
+
+    static constexpr auto Value = F;
+};
+
+////////////////////////////////////////////////////////////////////////////
+// "IsForEachFunctor" (primary template). Determines if template arg "T" is
+// a functor type whose "operator()" member has the following signature and
+// is also callable in the context of whether "T" is "const" and/or
+// "volatile" and or an lvalue or rvalue (read on):
+//
+//     template <std::size_t I>
+//     bool operator()() [const] [volatile] [&|&&];
+//
+// If "T" contains this function AND it can also be called on an instance
+// of "T" (again, read on), then "T" qualifies as a functor that can be
+// passed to function template "ForEach()" declared later on. Note that the
+// specialization just below does the actual work of checking for this. It
+// simply invokes the above function template in an unevaluated context
+// using "std::declval()" as follows:
+//
+//     T::operator<0>()
+//
+// If the call succeeds then "operator()" must not only exist as a member
+// of "T" with a "bool" return type (we check for this as well), but it's
+// also callable in the context of whether "T" is "const" and/or "volatile"
+// and or an lvalue or rvalue. Note that to qualify as an lvalue for
+// purposes of "IsForEachFunctor", "T" must be an lvalue reference such as
+// "int &". To qualify as an rvalue, "T" must either be a non-reference
+// type such as a plain "int" OR an rvalue reference such as "int &&". The
+// behaviour of what qualifies as an lvalue and rvalue for purposes of
+// using "IsForEachFunctor" therefore follows the usual perfect forwarding
+// rules for function template arguments (where an lvalue reference for "T"
+// means the function's "T &&" argument collapses to an lvalue reference,
+// and a non-reference type or rvalue reference type for "T" means the
+// function's "T &&" argument is an rvalue reference - read up on perfect
+// forwarding for details if you're not already familiar this).
+//
+// As an example, if "T" contains the above "operator()" template but it's
+// not declared with the "const" qualifier but "T" itself is (declared
+// "const"), then calling the function as shown above fails since you can't
+// call a non-const member function using a constant object. The primary
+// template therefore kicks in, inheriting from "std::false_type".
+// Similarly, if "operator()" is declared with the "&&" reference qualifier
+// (rare as this is in practice), but "T" is an lvalue reference, then
+// again, the above call fails since you can't invoke a member function
+// declared with the "&&" (rvalue) reference qualifier using an lvalue
+// reference. Again, the primary template will therefore kick in (once
+// again inheriting from "std::false_type"). The upshot is that not only
+// must "operator()" exist as a member of "T", it must also be callable in
+// the context of "T" itself (whether "T" is "const" and/or "volatile"
+// and/or an lvalue reference, rvalue reference or non-reference - in all
+// cases "operator()" must be properly declared to support calls based on
+// the cv-qualifiers and/or lvalue/rvalue state of "T" itself as described
+// above). If it is then the specialization kicks in and "IsForEachFunctor"
+// therefore inherits from "std::true_type" (meaning "T" is a suitable
+// functor type for passing as the 2nd template arg of function template
+// "ForEach()").
+////////////////////////////////////////////////////////////////////////////
+template <typename T, typename = void>
+struct IsForEachFunctor : std::false_type
+{
+};
+
+/////////////////////////////////////////////////////////////////
+// Specialization of "IsForEachFunctor" (primary) template just
+// above. This specialization does all the work. See primary
+// template above for details. Note that calls to "declval(T)"
+// return "T &&" (unless "T" is void - see "declval()" docs) so
+// the following call to this works according to the usual
+// perfect forwarding rules in C++. That is, if "T" is an lvalue
+// reference then "declval()" returns an lvalue reference (due
+// to the C++ reference collapsing rules), otherwise "T" must be
+// an a non-reference or an rvalue reference so "declval"
+// returns an rvalue reference (in either case). In all cases
+// "declval()" therefore returns the same function argument type
+// used in a perfect forwarding function. Such arguments are
+// always of the type "T &&" which resolves to an lvalue
+// reference only if "T" is an lvalue reference (again, due to
+// the C++ reference collapsing rules), or an rvalue reference
+// if "T" is a non-reference or rvalue reference. "declval()"
+// therefore returns the exact same type as a perfectly
+// forwarded argument after plugging in "T" which is what we
+// require here (we're invoking "operator()" on that argument in
+// the following call in an unevaluated context simply to make
+// sure it can be invoked - the primary template kicks in via
+// SFINAE otherwise).
+/////////////////////////////////////////////////////////////////
+template <typename T>
+struct IsForEachFunctor<T,
+                        // See explanation of "declval()" in comments above
+                        std::enable_if_t<std::is_same_v<decltype(std::declval<T>().template operator()<std::size_t(0)>()), bool>>
+                       > : std::true_type
+{
+};
+
+/////////////////////////////////////////////////////////
+// Helper variable template for "IsForEachFunctor" just
+// above (with the usual "_v" suffix).
+/////////////////////////////////////////////////////////
+template <typename T>
+inline constexpr bool IsForEachFunctor_v = IsForEachFunctor<T>::value;
+
+//////////////////////////////////////////////
+// Concept for above template (see following
+// #defined constant for details)
+//////////////////////////////////////////////
+#if CONCEPTS_SUPPORTED
+    template <typename T>
+    concept ForEachFunctor_c = IsForEachFunctor_v<T>;
+
+    #define FOR_EACH_FUNCTOR_C StdExt::ForEachFunctor_c
+#else
+    #define STATIC_ASSERT_IS_FOR_EACH_FUNCTOR(T) static_assert(StdExt::IsForEachFunctor_v<T>);
+
+    #define FOR_EACH_FUNCTOR_C typename
+#endif
+
+/////////////////////////////////////////////////////
+// For internal use only (by "ForEach()" just after
+// this namespace)
+/////////////////////////////////////////////////////
+STDEXT_BEGIN_PRIVATE
+{
+    /////////////////////////////////////////////////////////////////
+    // ForEachImpl(). Private implementation function used by
+    // function template "ForEach()" declared just after this
+    // private namespace. See this for details. Invokes "functor"
+    // once for each "I" in "Is" (0 to N - 1 inclusive, offset by
+    // "Offset" which is zero unless called by "ForEachChunksImpl()"
+    // just below) via a single (non-recursive) fold expression over
+    // the "&&" operator, so iteration stops as soon as "functor"
+    // returns false (since "&&" short-circuits, and it's always
+    // evaluated left to right). Unlike a recursive implementation, this doesn't
+    // require instantiating a separate function for each "I"
+    // (nested "N" levels deep), so there's no risk of exceeding
+    // the compiler's instantiation depth limit for large "N", and
+    // no chain of nested calls the optimizer has to flatten. Note
+    // that "ForEachFunctorT" is always the same template type
+    // passed to "ForEach()", so either "T &" for the lvalue case
+    // or just plain "T" or "T &&" for the rvalue case (for the
+    // "rvalue" case however usually just plain "T" as per the
+    // usual perfect forwarding rules when invoking such functions
+    // via implicit type deduction).
+    /////////////////////////////////////////////////////////////////
+    template <std::size_t Offset, typename ForEachFunctorT, std::size_t... Is>
+    inline constexpr bool ForEachImpl(ForEachFunctorT &&functor, std::index_sequence<Is...>)
+    {
+        //////////////////////////////////////////////////////////
+        // Note: Call to "std::forward()" here required to:
+        // 
+        //    1) Perfect forward "functor" back to "&" or "&&"
+        //       accordingly
+        //    2) In the "&&" case, invoke "operator()" in the
+        //       context of an rvalue (in particular, can't do
+        //       this on "functor" directly, without invoking
+        //       "std::forward", since "functor" is an lvalue
+        //       so the lvalue version of "operator()" would kick
+        //       in in the following call instead!!)
+        //////////////////////////////////////////////////////////
+        return (std::forward<ForEachFunctorT>(functor).template operator()<Offset + Is>() && ...);
+    }
+
+    /////////////////////////////////////////////////////////////////
+    // Number of iterations each "ForEachImpl()" call (fold
+    // expression) above handles at most, when "ForEach()" is
+    // called for a larger "N" (see "ForEachChunksImpl()" just
+    // below).
+    /////////////////////////////////////////////////////////////////
+    inline constexpr std::size_t ForEachChunkSize = 256;
+
+    /////////////////////////////////////////////////////////////////
+    // ForEachChunksImpl(). Called by "ForEach()" instead of
+    // "ForEachImpl()" when "N" exceeds "ForEachChunkSize". Splits
+    // the "N" iterations into consecutive chunks of
+    // "ForEachChunkSize" (the last one possibly smaller), calling
+    // "ForEachImpl()" once for each chunk "Cs" via a fold
+    // expression over "&&" (so iteration still stops as soon as
+    // "functor" returns false). Compilers handle a single fold
+    // expression over "N" terms in time that grows much faster
+    // than "N" itself (the expression is nested "N" levels deep),
+    // so for "N" in the thousands, 2 levels of (much) shorter folds
+    // are far cheaper to compile (GCC 12 for instance takes 52
+    // seconds with a single fold when "N" is 64000, but 2 seconds
+    // this way).
+    /////////////////////////////////////////////////////////////////
+    template <std::size_t N, typename ForEachFunctorT, std::size_t... Cs>
+    inline constexpr bool ForEachChunksImpl(ForEachFunctorT &&functor, std::index_sequence<Cs...>)
+    {
+        ///////////////////////////////////////////////////////////
+        // Note: Qualified with "Private::" so no argument-dependent
+        // lookup occurs, which would otherwise instantiate every
+        // class the functor's type is specialized on (such as the
+        // "std::tuple" passed to "ForEachTupleType()" in C++17,
+        // which may be too large to instantiate)
+        ///////////////////////////////////////////////////////////
+        return (Private::ForEachImpl<Cs * ForEachChunkSize>(std::forward<ForEachFunctorT>(functor),
+                                                            std::make_index_sequence<(Cs + 1) * ForEachChunkSize <= N ? ForEachChunkSize
+                                                                                                                       : N - (Cs * ForEachChunkSize)>()) && ...);
+    }
+} // namespace Private
+STDEXT_END_PRIVATE
+
+///////////////////////////////////////////////////////////////////
+// ForEach(). Generic function template effectively equivalent to
+// a "for" loop but used at compile time to execute the given
+// "functor" "N" times (unless the "functor" arg returns false on
+// any of those iterations in which case processing immediately
+// stops and "false" is immediately returned - read on).    
+//
+// Note that "operator()" in your functor must be declared as follows
+// (and will typically be "const" as seen though it can be non-const
+// as well if required, and/or noexcept as well)
+//
+//     template <std::size_t I>
+//     bool operator()() const
+//     {
+//         // Process "I" accordingly
+//
+//         /////////////////////////////////////////////////////
+//         // "true" means continue processing so this function
+//         // will immediately be called again specialized on
+//         // "I + 1" until "N" is reached (EXclusive). Return
+//         // false instead to immediately stop processing
+//         // (equivalent to a "break" statement in a regular
+//         // "for" loop)
+//         /////////////////////////////////////////////////////
+//         return true;
+//     }
+//
+// "ForEach()" effectively stamps out "N" copies of "operator()"
+// above, once for each "I" in the range 0 to N - 1 inclusive
+// (unless "N" is zero in which case "operator()" is still stamped
+// out for "I" equal zero but never actually called - it's only
+// stamped out to validate that "ForEachFunctorT" is a valid
+// template arg but this means your functor shouldn't do anything
+// that might be illegal when "N" is zero, like invoke
+// "std::tuple_element_t" for instance, since index zero would be
+// illegal in this case so compilation will fail). In any case,
+// note that your functor should return true as seen above unless
+// you wish to "break" like in a normal "for" loop, in which case
+// it should return false. Either value (true or false) is
+// ultimately returned by the function. If true then "I" is simply
+// incremented by 1 and "operator()" is immediately called again
+// with the newly incremented "I". If false then processing
+// immediately exits instead and "operator()" isn't called again
+// (for "I + 1" and beyond). Note that all "N" copies of
+// "operator()" are stamped out regardless (since the loop is
+// implemented as a single fold expression, not recursively), but
+// only those that are actually reached are called.
+//
+//    Example (iterates all elements of a "std::tuple" but
+//             see the helper function "ForEachTupleType()"
+//             declared later which wraps the following so
+//             it's cleaner - for tuples you should rely
+//             on it instead normally but it ultimately
+//             just defers to "ForEach()" anyway)
+//    -----------------------------------------------------
+//    std::Tuple<int, float, double> myTuple; // Tuple with 3 elements whose types we wish to iterate (and display)
+//    using TupleT = decltype(myTuple); // Type of the above tuple
+// 
+//    //////////////////////////////////////////////////////
+//    // Lambda (template) stamped out and invoked 3 times
+//    // by "ForEach()" below (for I=0, I=1 and I=2). See
+//    // "ForEach()" comments below.
+//    //////////////////////////////////////////////////////
+//    const auto displayTupleElement = []<std::size_t I>()
+//                                     {
+//                                         // Type of the this tuple element (for the current "I")
+//                                         using TupleElement_t = std::tuple_element_t<I, TupleT>;
+// 
+//                                         /////////////////////////////////////////////////
+//                                         // Displays (literally) "int" when I=0, "float"
+//                                         // when I=1 and "double" when I=2 (for this
+//                                         // particular tuple - see "myTuple above)
+//                                         /////////////////////////////////////////////////
+//                                         std::cout << TypeName_v<TupleElement_t> << "\n";
+//        
+//                                         //////////////////////////////////////////////
+//                                         // Return false here instead if you need to
+//                                         // stop processing (equivalent to "break" in
+//                                         // a normal "for" loop). Returning "true"
+//                                         // insteaad as we're doing here means all
+//                                         // tuple elements will be processed.
+//                                         //////////////////////////////////////////////
+//                                         return true;
+//                                     };
+//
+//     ///////////////////////////////////////////////////////////////////
+//     // Call "ForEach()" which iterates (effectively does a "foreach")
+//     // of the above lambda "N" times, where "N" is explicitly passed
+//     // as the 1st template arg to "ForEach()" (the number of elements
+//     // in our tuple, 3 in this case), and the 2nd template arg, the
+//     // type of the functor, "ForEachFunctorT", is implicitly deduced
+//     // from the arg itself. We're passing "displayTupleElement" so
+//     // the 2nd template arg is implicitly deduced to the type of this
+//     // functor, i.e., whatever class the compiler generates for the
+//     // above lambda behind the scenes (recall that a lambda is just
+//     // syntactic sugar for a compiler-generated functor). The upshot
+//     // is that "operator()" in this functor (the above lambda) is
+//     // effectively stamped out 3 times and invoked for each (for I=0,
+//     // I=1 and I=2)
+//     ///////////////////////////////////////////////////////////////////
+//     ForEach<std::tuple_size_v<TupleT>>(displayTupleElement);
+///////////////////////////////////////////////////////////////////
+template <std::size_t N, FOR_EACH_FUNCTOR_C ForEachFunctorT>
+inline constexpr bool ForEach(ForEachFunctorT&& functor)
+{
+    // See this constant for details
+    #if !CONCEPTS_SUPPORTED
+        /////////////////////////////////////////////////////
+        // Kicks in if concepts not supported, otherwise
+        // FOR_EACH_FUNCTOR_C concept kicks in above instead
+        // (latter simply resolves to the "typename" keyword
+        // when concepts aren't supported)
+        /////////////////////////////////////////////////////
+        STATIC_ASSERT_IS_FOR_EACH_FUNCTOR(ForEachFunctorT);
+    #endif
+
+    //////////////////////////////////////////////////////////
+    // Defer to "Private::ForEachImpl()" which calls
+    // "functor" "N" times or until "functor" returns false,
+    // whichever comes first (false only returned if
+    // "functor" wants to break like a normal "for" loop,
+    // which rarely happens in practice so we usually
+    // iterate "N" times). For large "N" we defer to
+    // "Private::ForEachChunksImpl()" instead which calls
+    // "Private::ForEachImpl()" once for each chunk of
+    // "Private::ForEachChunkSize" iterations (see this for
+    // details).
+    //
+    // Note: "std::forward" is mandatory here because
+    // "functor" is an lvalue even in the "&&" case (since
+    // it's named - named rvalue references are still
+    // lvalues). Attempting to pass "functor" directly would
+    // therefore cause a compiler error since you can't bind
+    // an lvalue (functor) to an rvalue reference (the arg
+    // type that "Private::ForEachImpl()" is expecting in
+    // this case).
+    ///////////////////////////////////////////////////////////
+    if constexpr (N <= Private::ForEachChunkSize)
+    {
+        return Private::ForEachImpl<0>(std::forward<ForEachFunctorT>(functor), std::make_index_sequence<N>());
+    }
+    else
+    {
+        return Private::ForEachChunksImpl<N>(std::forward<ForEachFunctorT>(functor), std::make_index_sequence<(N + Private::ForEachChunkSize - 1) / Private::ForEachChunkSize>());
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////
+// "IsForEachTupleFunctor" (primary template). Determines if template arg
+// "T" is a functor type whose "operator()" member has the following
+// signature and is also callable in the context of whether "T" is "const"
+// and/or "volatile" and or an lvalue or rvalue (read on):
+//
+//     template <std::size_t I, typename TupleElementT>
+//     bool operator()() [const] [volatile] [&|&&];
+//
+// If "T" contains this function AND it can also be called on an instance
+// of "T" (again, read on), then "T" qualifies as a functor that can be
+// passed to function template "ForEachTupleType()" declared later on. Note
+// that the specialization just below does the actual work of checking for
+// this. It simply invokes the above function template in an unevaluated
+// context using "std::declval()" as follows:
+//
+//     T::operator<0, void>()
+//
+// If the call succeeds then "operator()" must not only exist as a member
+// of "T" with a "bool" return type (we check for this as well), but it's
+// also callable in the context of whether "T" is "const" and/or "volatile"
+// and or an lvalue or rvalue. Note that to qualify as an lvalue for
+// purposes of "IsForEachTupleFunctor", "T" must be an lvalue reference
+// such as "int &". To qualify as an rvalue, "T" must either be a
+// non-reference type such as a plain "int" OR an rvalue reference such as
+// "int &&". The behaviour of what qualifies as an lvalue and rvalue for
+// purposes of using "IsForEachTupleFunctor" therefore follows the usual
+// perfect forwarding rules for function template arguments (where an
+// lvalue reference for "T" means the function's "T &&" argument collapses
+// to an lvalue reference, and a non-reference type or rvalue reference
+// type for "T" means the function's "T &&" argument is an rvalue reference
+// - read up on perfect forwarding for details if you're not already
+// familiar this).
+//
+// As an example, if "T" contains the above "operator()" template but it's
+// not declared with the "const" qualifier but "T" itself is (declared
+// "const"), then calling the function as shown above fails since you can't
+// call a non-const member function using a constant object. The primary
+// template therefore kicks in, inheriting from "std::false_type".
+// Similarly, if "operator()" is declared with the "&&" reference qualifier
+// (rare as this is in practice), but "T" is an lvalue reference, then
+// again, the above call fails since you can't invoke a member function
+// declared with the "&&" (rvalue) reference qualifier using an lvalue
+// reference. Again, the primary template will therefore kick in (once
+// again inheriting from "std::false_type"). The upshot is that not only
+// must "operator()" exist as a member of "T", it must also be callable in
+// the context of "T" itself (whether "T" is "const" and/or "volatile"
+// and/or an lvalue reference, rvalue reference or non-reference - in all
+// cases "operator()" must be properly declared to support calls based on
+// the cv-qualifiers and/or lvalue/rvalue state of "T" itself as described
+// above). If it is then the specialization kicks in and
+// "IsForEachTupleFunctor" therefore inherits from "std::true_type"
+// (meaning "T" is a suitable functor type for passing as the 2nd template
+// arg of function template "ForEachTupleType()").
+////////////////////////////////////////////////////////////////////////////
+template <typename T, typename = void>
+struct IsForEachTupleFunctor : std::false_type
+{
+};
+
+/////////////////////////////////////////////////////////////////
+// Specialization of "IsForEachTupleFunctor" (primary) template
+// just above. This specialization does all the work. See
+// primary template above for details. Note that calls to
+// "declval(T)" return "T &&" (unless "T" is void - see
+// "declval()" docs) so the following call to this works
+// according to the usual perfect forwarding rules in C++. That
+// is, if "T" is an lvalue reference then "declval()" returns an
+// lvalue reference (due to the C++ reference collapsing rules),
+// otherwise "T" must be an a non-reference or an rvalue
+// reference so "declval" returns an rvalue reference (in either
+// case). In all cases "declval()" therefore returns the same
+// function argument type used in a perfect forwarding function.
+// Such arguments are always of the type "T &&" which resolves
+// to an lvalue reference only if "T" is an lvalue reference
+// (again, due to the C++ reference collapsing rules), or an
+// rvalue reference if "T" is a non-reference or rvalue
+// reference. "declval()" therefore returns the exact same type
+// as a perfectly forwarded argument after plugging in "T" which
+// is what we require here (we're invoking "operator()" on that
+// argument in the following call in an unevaluated context
+// simply to make sure it can be invoked - the primary template
+// kicks in via SFINAE otherwise).
+/////////////////////////////////////////////////////////////////
+template <typename T>
+struct IsForEachTupleFunctor<T,
+                             // See explanation of "declval()" in comments above
+                             std::enable_if_t<std::is_same_v<decltype(std::declval<T>().template operator()<std::size_t(0), void>()), bool>>
+                            > : std::true_type
+{
+};
+
+/////////////////////////////////////////////////////////
+// Helper variable template for "IsForEachTupleFunctor"
+// just above (with the usual "_v" suffix).
+/////////////////////////////////////////////////////////
+template <typename T>
+inline constexpr bool IsForEachTupleFunctor_v = IsForEachTupleFunctor<T>::value;
+
+//////////////////////////////////////////////
+// Concept for above template (see following
+// #defined constant for details)
+//////////////////////////////////////////////
+#if CONCEPTS_SUPPORTED
+    template <typename T>
+    concept ForEachTupleFunctor_c = IsForEachTupleFunctor_v<T>;
+
+    #define FOR_EACH_TUPLE_FUNCTOR_C StdExt::ForEachTupleFunctor_c
+#else
+    #define STATIC_ASSERT_IS_FOR_EACH_TUPLE_FUNCTOR(T) static_assert(StdExt::IsForEachTupleFunctor_v<T>);
+
+    #define FOR_EACH_TUPLE_FUNCTOR_C typename
+#endif
+
+///////////////////////////////////////////////////////////////////////////
+// For C++17 only we'll rely on the "ProcessTupleType" functor declared
+// just below (used exclusively by function template "ForEachTupleType()"
+// declared just after). For C++20 and later we'll rely on a lambda
+// template instead (the equivalent of the struct just below but locally
+// declared in function template "ForEachTupleType()" so it's cleaner).
+// Note that lambda templates aren't supported until C++20. Lastly, note
+// that we're currently inside a "#if CPP17_OR_LATER" preprocessor block
+// (we're processing code for C++17 or later) so if the #defined constant
+// CPP17_OR_EARLIER we're testing just below is false (0), then we're
+// guaranteed to be processing C++20 or later (again, because we know that
+// the #defined constant CPP17_OR_LATER is currently true).
+// /////////////////////////////////////////////////////////////////////////
+#if CPP17_OR_EARLIER
+    ///////////////////////////////////////////////////
+    // For internal use only (by "ForEachTupleType()"
+    // just after this namespace)
+    ///////////////////////////////////////////////////
+    STDEXT_BEGIN_PRIVATE
+    {
+        /////////////////////////////////////////////////////////////
+        // class ProcessTupleType. Private implementation class
+        // used by function template "ForEachTupleType()" declared
+        // just after this private namespace. See this for
+        // details.  Note that in the following class,
+        // "ForEachTupleFunctorT" is always the same template type
+        // passed to "ForEachTupleType()", so either "T &" for the
+        // lvalue case or just plain "T" or "T &&" for the rvalue
+        // case (for the "rvalue" case however usually just plain
+        // "T" as per the usual perfect forwarding rules when
+        // invoking such functions via implicit type deduction).
+        ///////////////////////////////////////////////////////////
+        template <typename TupleT, typename ForEachTupleFunctorT>
+        class ProcessTupleType
+        {
+            STATIC_ASSERT_IS_TUPLE(TupleT);
+            STATIC_ASSERT_IS_FOR_EACH_TUPLE_FUNCTOR(ForEachTupleFunctorT);
+
+        public:
+            /////////////////////////////////////////////////////////
+            // Constructor. Note that we always pass "functor" by a
+            // "std::forward" reference so "functor" resolves to "&"
+            // or "&&" accordingly
+            /////////////////////////////////////////////////////////
+            constexpr ProcessTupleType(ForEachTupleFunctorT &&functor) noexcept
+                ///////////////////////////////////////////////////////////
+                // "std::forward" required when "ForEachTupleFunctorT" is
+                // "&&". Both "functor" and "m_Functor" are therefore "&&"
+                // but "functor" is still an lvalue because it's named
+                // (rvalue references that are named are lvalues!).
+                // Therefore illegal to bind an lvalue (functor) to an
+                // rvalue reference (m_Functor) so "std::forward" is
+                // required to circumvent this (for the "&&" case it
+                // returns an "&&" reference but it's now unnamed so an
+                // rvalue and therefore suitable for initializing
+                // "m_Functor")
+                ///////////////////////////////////////////////////////////
+                : m_Functor(std::forward<ForEachTupleFunctorT>(functor))
+            {
+            }
+
+            template <std::size_t I>
+            constexpr bool operator()() const
+            {
+                using TupleElement_t = StdExt::TupleElement_t<I, TupleT>;
+
+                //////////////////////////////////////////////////////////
+                // Note: Call to "std::forward()" here required to:
+                // 
+                //    1) Perfect forward "m_Functor" back to "&" or "&&"
+                //       accordingly
+                //    2) In the "&&" case, invoke "operator()" in the
+                //       context of an rvalue (in particular, can't do
+                //       this on "m_Functor" directly, without invoking
+                //       "std::forward", since "m_Functor" is an lvalue
+                //       so the lvalue version of "operator()" would kick
+                //       in in the following call instead!!)
+                //////////////////////////////////////////////////////////
+                return std::forward<ForEachTupleFunctorT>(m_Functor).template operator()<I, TupleElement_t>();
+            }
+
+        private:
+            /////////////////////////////////////////////////////
+            // Note: Resolves to "&" in the lvalue case or "&&"
+            // otherwise (by the usual C++ reference collapsing
+            // rules - "ForEachTupleFunctorT" is always "T &"
+            // in the former case or either plain "T" or "T &&"
+            // otherwise)
+            /////////////////////////////////////////////////////
+            ForEachTupleFunctorT &&m_Functor;
+        };
+    } // namespace Private
+    STDEXT_END_PRIVATE
+#endif
+
+/////////////////////////////////////////////////////////////////////////
+// ForEachTupleType(). Iterates all tuple elements in "TupleT" where
+// "TupleT" is a "std::tuple" specialization, and invokes the given
+// "functor" for each. The effect of this function is that all types in
+// "TupleT" are iterated or none if "TupleT" is empty. For each type in
+// "TupleT", the given "functor" is invoked as noted. "functor" must be
+// a functor with the following functor (template) signature (where
+// items in square brackets are optional - note that an invalid functor
+// will trigger the FOR_EACH_TUPLE_FUNCTOR_C concept in C++20 or later,
+// or a "static_assert" in C++17, since we don't support earlier
+// versions - compile fails either way)
+//
+//     template <std::size_t I, typename TupleElementT>
+//     bool operator()() [const] [volatile] [ref-qualifier] [noexcept];
+//
+// Note that lambdas with this signature are also (therefore) supported
+// in C++20 or later (since lambda templates aren't supported in earlier
+// versions of C++ so you'll have to roll your own functor template if
+// targeting C++17). Note that free functions or other non-static member
+// functions besides "operator()" are not currently supported (but may
+// be in a future release):
+//
+//     Example
+//     -------
+//     ////////////////////////////////////////////////////////
+//     // Some tuple whose types you wish to iterate (display
+//     // in this example - see "displayTupleType" lambda
+//     // below).
+//     ////////////////////////////////////////////////////////
+//     std::tuple<int, float, double> someTuple;
+//
+//     /////////////////////////////////////////////////////////////////
+//     // Lambda that will be invoked just below, once for each type in
+//     // "someTuple()" above (where template arg "I" is the zero-based
+//     // "Ith" index of the type in "someTuple", and "TupleElementT" is
+//     // its type). Note that lambda templates are supported in C++20
+//     // and later only. For C++17 (this header doesn't support earlier
+//     // versions), you need to roll your own functor instead (with a
+//     // template version of "operator()" equivalent to this lambda)
+//     /////////////////////////////////////////////////////////////////
+//     const auto displayTupleType = []<std::size_t I, typename TupleElementT>()
+//                                   {
+//                                       /////////////////////////////////////////////////////////
+//                                       // Display the type of the (zero-based) "Ith" type in
+//                                       // "someTuple" using the following format (shown here
+//                                       // for "I" equals zero so "TupleElementT" is therefore
+//                                       // an "int", but whatever "I" and "TupleElementT" are
+//                                       // on each iteration - note that we increment zero-based
+//                                       // "I" by 1 however to display it as 1-based since it's
+//                                       // more natural for display purposes):
+//                                       //
+//                                       //    1) int
+//                                       //
+//                                       // Note that we never come through here if the tuple
+//                                       // represented by "someTuple" is empty.
+//                                       /////////////////////////////////////////////////////////
+//                                       tcout << (I + 1) << _T(") ") << TypeName_v<TupleElementT> << _T("\n");
+//
+//                                       //////////////////////////////////////////////
+//                                       // Return true to continue iterating (false
+//                                       // would stop iterating, equivalent to a
+//                                       // "break" statement in a regular "for" loop)
+//                                       //////////////////////////////////////////////
+//                                       return true;
+//                                   };
+//
+//     ///////////////////////////////////////////////////////////////
+//     // Iterate all tuple elements in "someTuple" meaning once for
+//     // each type in "someTuple()" above. Invokes "displayTupleType"
+//     // above for each. Outputs the following:
+//     //
+//     //     1) int
+//     //     2) float
+//     //     3) double
+//     //
+//     // Note that "ForEachTupleType()" returns true if the functor
+//     // you pass ("displayTupleType" in this example) returns true
+//     // or false otherwise (useful if your functor needs to "break"
+//     // like a normal "for" loop for any reason - iteration
+//     // immediately stops if it returns false and the following
+//     // therefore returns false). Always returns true in the above
+//     // example (and typically in most real-world code as well)
+//     ///////////////////////////////////////////////////////////////
+//     ForEachTupleType<decltype(someTuple)>(displayTupleType);
+/////////////////////////////////////////////////////////////////////////
+template <TUPLE_C TupleT, FOR_EACH_TUPLE_FUNCTOR_C ForEachTupleFunctorT>
+inline constexpr bool ForEachTupleType(ForEachTupleFunctorT&& functor)
+{
+    // See this constant for details
+    #if !CONCEPTS_SUPPORTED
+        //////////////////////////////////////////////////
+        // Kicks in if concepts not supported, otherwise
+        // TUPLE_C concept kicks in above instead (latter
+        // simply resolves to the "typename" keyword when
+        // conppets not supported)
+        //////////////////////////////////////////////////
+        STATIC_ASSERT_IS_TUPLE(TupleT)
+
+        ///////////////////////////////////////////////
+        // Kicks in if C++ 17 or earlier, otherwise
+        // FOR_EACH_TUPLE_FUNCTOR_C concept kicks in
+        // above instead (latter simply resolves to
+        // the "typename" keyword in C++17 or earlier)
+        ///////////////////////////////////////////////
+        STATIC_ASSERT_IS_FOR_EACH_TUPLE_FUNCTOR(ForEachTupleFunctorT)
+    #endif
+
+    /////////////////////////////////////////////////////////////////
+    // IMPORTANT
+    // ---------
+    // (Note: You need not read this (very) long explanation since
+    // we've correctly worked around it as described below, but I've
+    // included it here for posterity).
+    //
+    // The following call checks for zero as seen (true only when
+    // "TupleT" is empty), in order to completely bypass the call to
+    // "ForEach()" seen further below (when "TupleT" isn't empty).
+    // There's no need to call "ForEach()" further below if the
+    // tuple is empty since there's nothing to iterate. Note however
+    // that the latter call to "ForEach()" itself will also handle
+    // an empty tuple, since it will immediately return true if its
+    // "N" template arg is zero (0). The following check for an
+    // empty tuple would therefore seem to be redundant
+    // (unnecessary), since "ForEach()" also correctly deals with
+    // the situation. However, there's a subtle issue at play here
+    // that requires us not to call "ForEach()" when the tuple is in
+    // fact empty. Doing so would mean that the "operator()"
+    // template member of the "processTupleType" functor we're
+    // passing to "ForEach" below will be specialized on zero, (its
+    // "std::size_t" template arg will be zero), even though it will
+    // never actually be called by "ForEach()" (since the tuple is
+    // empty). "operator()" is still specialized on zero however
+    // because when "ForEach()" is stamped out on the template args
+    // we pass it, "IsForEachFunctor_v" is called to check if the
+    // 2nd template arg of "ForEach()" is a valid functor type. This
+    // occurs via a "static_assert" in C++17 or a concept in C++20
+    // or later, but in either case "IsForEachFunctor_v" is called
+    // and the implementation for this stamps out a copy of the
+    // functor's "operator()" template arg, again, doing so with
+    // template arg zero (0). "operator()" isn't actually called at
+    // this time however, only stamped out (specialized on template
+    // arg zero), simply to make sure the functor type being passed
+    // is valid. If not then "IsForEachFunctor_v" will return false
+    // and the "static_assert" in C++17 or concept in C++20 or later
+    // will correctly trap the situation at compile time (i.e., an
+    // invalid type is being passed for the 2nd template arg of
+    // "ForEach"). However, if the 1st template arg of "ForEach",
+    // namely "N" (the number of iterations it will be called for),
+    // is zero itself, then although the functor's "operator()"
+    // template member will never be called since "N" is zero as
+    // noted (so there will beno iterations), "IsForEachFunctor_v"
+    // itself will still stamp out "operator()" with its
+    // "std::size_t" template arg set to zero (0) as just described.
+    // Note that "IsForEachFunctor_v" has no choice but to stamp out
+    // "operator()" since there's no other way in C++ for it do its
+    // job at this writing (check if a type is a functor with a
+    // template member, in this case "operator()" with a
+    // "std::size_t" template arg).
+    //
+    // There's a problem with this situation however. Our
+    // (identical) implementation of "operator()" seen in both the
+    // lambda below (for C++20 and later), or in class
+    // "Private::ProcessTupleType" (C++17 only), both call
+    // "std::tuple_element_t<I, TupleT>", but if the "TupleT"
+    // template are we're passing to this is empty, then it's
+    // illegal to call it for any index including zero (since the
+    // tuple is empty so even index zero is out of bounds). Template
+    // "I" in this call (zero) is therefore an invalid index so
+    // compilation will therefore fail (but not in C++17 for reasons
+    // unknown - read on). The upshot is that when dealing with an
+    // empty tuple, i.e., the "TupleT" template arg of the function
+    // you're now reading is empty, we can't call "ForEach()"
+    // because even though it won't iterate the functor it's being
+    // passed (since the "N" template arg of "ForEach()" will be
+    // zero in this case), the call to "IsForEachFunctor_v" that
+    // occurs merely by stamping out "ForEach()" will cause the call
+    // to "std::tuple_element_t<I, TupleT>" in our functor to choke
+    // during compilation (since it's stamped out with its "I"
+    // template arg set to zero but the "TupleT" template arg is
+    // empty so "I" is an illegal index). Again, this occurs even
+    // though the code is never actually called, but it's illegal
+    // even to stamp it out in this case.
+    //
+    // Please note that as previously mentioned, this situation only
+    // occurs in C++20 or later. In this case the lambda seen in the
+    // code below would trigger the problem without explicit action
+    // to circumvent it (which the following "if constexpr" does),
+    // but in C++17 the problem doesn't occur. In C++17 the same
+    // code seen in the lambda below exists but in
+    // "Private::ProcessTupleType::operator()" instead (the lambda
+    // below targets C++20 or later only), but for reasons unknown
+    // (I haven't investigated), in C++17 no compilation error
+    // occurs on the call to "std::tuple_element_t<I, TupleT>" (as
+    // described). It's likely (presumably) not being stampled out
+    // in this case. Testing shows however that if we allowed the
+    // same code to be compiled in C++20, instead of the lambda
+    // below (that we actually rely on in C++20 or later), it will
+    // also fail. IOW, this whole situation surrounding
+    // "std::tuple_element_t<I, TupleT>" only starts surfacing in
+    // C++20 so something clearly has changed between C++17 and
+    // C++20 (since what compiled without error in C++17 now fails
+    // in C++20). This should be investigated but it's a moot point
+    // for now since the following "if constexpr" statemement
+    // prevents the issue altogether. Note that the functor now
+    // calls our own "TupleElement_t<I, TupleT>" instead (see
+    // this), but an out-of-bounds index is
+    // just as illegal there, so the "if constexpr" is still needed
+    /////////////////////////////////////////////////////////////////
+    if constexpr (std::tuple_size_v<TupleT> != 0)
+    {
+        // Lambda templates not supported until C++20
+        #if CPP20_OR_LATER
+            ////////////////////////////////////////////////////////
+            // Lambda template we'll be calling once for each type
+            // in template arg "TupleT" (equivalent to the
+            // "Private::ProcessTupleType" functor in C++17 or
+            // earlier below). Each iteration invokes "functor",
+            // where processing stops after all types in "TupleT"
+            // have been processed or "functor" returns false,
+            // whichever comes first  (false only returned if
+            // "functor" wants to break like a normal "for" loop,
+            // which rarely happens in practice so we usually
+            // iterate all tuple types in "TupleT")
+            //
+            // IMPORTANT:
+            // ---------
+            // See the IMPORTANT comments about the capture of
+            // "functor" in function template "ForEach()" (in the
+            // comments preceding its own lambda template). The
+            // same situation described there applies here as well.
+            ////////////////////////////////////////////////////////
+            const auto processTupleType = [&functor]<std::size_t I>()
+                                          {
+                                              using TupleElement_t = StdExt::TupleElement_t<I, TupleT>;
+
+                                              /////////////////////////////////////////////////////
+                                              // IMPORTANT:
+                                              // ---------
+                                              // See the IMPORTANT comments inside the lambda of
+                                              // function template "ForEach()" (just before its
+                                              // own call to "std::forward()"). The same situation
+                                              // described there applies here as well.
+                                              /////////////////////////////////////////////////////
+                                              return std::forward<ForEachTupleFunctorT>(functor).template operator()<I, TupleElement_t>();
+                                          };
+        #else // C++17 (using our own functor instead, equivalent to above lambda) ...
+            ////////////////////////////////////////////////////////////
+            // Create an instance of "Private::ProcessTupleType", a
+            // functor we'll be calling once for each type in template
+            // arg "TupleT" (equivalent to the lambda in C++20 or later
+            // above). Each iteration invokes "functor", where
+            // processing stops after all types in "TupleT" have been
+            // processed or "functor" returns false, whichever comes
+            // first (false only returned if "functor" wants to break
+            // like a normal "for" loop, which rarely happens in
+            // practice so we usually iterate all types in "TupleT")
+            //
+            // Note: The "ForEachTupleFunctorT" template arg we're
+            // passing here as the 2nd template arg of class of
+            // "Private::ProcessTupleType" means that the latter's
+            // constructor will take the same arg type as "functor"
+            // itself (& or && as usual). We then call "std::forward"
+            // as seen to pass "functor" to the constructor. Note that
+            // "std::forward" is mandatory here because "functor" is an
+            // lvalue even in the && case (since it's named - named
+            // rvalue references are still lvalues). Attempting to pass
+            // "functor" directly would therefore cause a compiler
+            // error since you can't bind an lvalue (functor) to an
+            // rvalue reference (the arg type that the
+            // "Private::ProcessTupleType" constructor is expecting in
+            // this case).
+            ////////////////////////////////////////////////////////////
+            const Private::ProcessTupleType<TupleT, ForEachTupleFunctorT> processTupleType(std::forward<ForEachTupleFunctorT>(functor));
+        #endif
+
+        ///////////////////////////////////////////////////////////////
+        // Defer to this function template further above, passing the
+        // number of elements in the tuple as the function's template
+        // arg, and "processTupleType" as the function's functor arg.
+        // The "ForEachFunctorT" template arg of "ForEach()" is
+        // therefore deduced to be the type of "processTupleType".
+        // "ForEach()" will then invoke this functor once for each
+        // element in the tuple given by "TupleT". Note that the call
+        // is qualified with "StdExt::" so no argument-dependent lookup
+        // occurs, since in C++17 it would instantiate "TupleT" itself
+        // (as "processTupleType" is specialized on it), exceeding the
+        // compiler's instantiation depth limit for large tuples (most
+        // implementations of "std::tuple" are recursive).
+        ///////////////////////////////////////////////////////////////
+        return StdExt::ForEach<std::tuple_size_v<TupleT>>(processTupleType);
+    }
+    else
+    {
+        return true;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////
+// ForEachFunctionTraitsArg(). Iterates all tuple elements in member
+// "FunctionTraitsT::ArgTypes", where "FunctionTraitsT" is a
+// "FunctionTraits" specialization, and invokes the given "functor"
+// for each. Also see helper function "ForEachArg()" just below which
+// just defers to the function you're now reading (and easier to use
+// so you should normally use it instead - the function you're now
+// reading should normally be used only if you already have an
+// existing "FunctionTraits" you're working with, otherwise
+// "ForEachArg()" creates a "FunctionTraits" for you so it's less
+// verbose than calling the following function directly).
+//
+// The effect of this function is that all (non-variadic) args in the
+// function that the given "FunctionTraits" was specialized on are
+// iterated or none if that function has no args. For each argument
+// type, the given "functor" is invoked as noted. "functor" must be a
+// functor with the following functor (template) signature (where
+// items in square brackets are optional - note that an invalid
+// functor will trigger the FOR_EACH_TUPLE_FUNCTOR_C concept in C++20
+// or later, or a "static_assert" in C++17, since we don't support
+// earlier versions - compile fails either way):
+//
+//     template <std::size_t I, typename ArgTypeT>
+//     bool operator()() [const] [volatile] [ref-qualifier] [noexcept];
+//
+// Note that lambdas with this signature are also (therefore)
+// supported in C++20 or later (since lambda templates aren't
+// supported in earlier versions of C++ so you'll have to roll your
+// own functor template if targeting C++17). Note that free functions
+// or other non-static member functions besides "operator()" are not
+// currently supported (but may be in a future release):
+//
+//
+//     Example
+//     -------
+//     ////////////////////////////////////////////////////
+//     // Prototype of some function whose arg types you
+//     // wish to iterate (display in this example - see
+//     // "displayArgType" lambda below). Note that we're
+//     // using a raw C++ function type in this example
+//     // (just a free-function prototype), but pointers
+//     // and references to functions are also supported
+//     // (though references to non-static member functions
+//     // are illegal in C++), as well as references to
+//     // pointers, and non-overloaded functors (or
+//     // references to functors)
+//     ////////////////////////////////////////////////////
+//     int SomeFunc(int arg1, float arg2, double arg3);
+//
+//     ///////////////////////////////////////////////////////////////
+//     // "FunctionTraits" specialization for the above function.
+//     // Note that you can pass any function type for its template
+//     // arg (free functions, member functions, pointers to
+//     // functions, references to functions, references to pointers
+//     // to functions and non-overloaded functors). The resulting
+//     // "FunctionTraits" specialization therefore captures all
+//     // (most) info about whatever function you pass (its return
+//     // type, argument types and other info). See "FunctionTraits"
+//     // for details (we'll be iterating its "ArgTypes" member
+//     // below).
+//     ///////////////////////////////////////////////////////////////
+//     using SomeFuncTraits = FunctionTraits<decltype(SomeFunc)>;
+//
+//     /////////////////////////////////////////////////////////////////
+//     // Lambda that will be invoked just below, once for each arg in
+//     // "SomeFunc()" above (where template arg "I" is the zero-based
+//     // "Ith" argument of "SomeFunc()", and "ArgTypeT" is its type).
+//     // Note that lambda templates are supported in C++20 and later
+//     // only. For C++17 (this header doesn't support earlier versions),
+//     // you need to roll your own functor instead (with a template
+//     // version of "operator()" equivalent to this lambda)
+//     /////////////////////////////////////////////////////////////////
+//     const auto displayArgType = []<std::size_t I, typename ArgTypeT>()
+//                                 {
+//                                     /////////////////////////////////////////////////////////
+//                                     // Display the type of the (zero-based) "Ith" arg in
+//                                     // "SomeFunc" using the following format (shown here for
+//                                     // "I" equals zero so "ArgTypeT" is therefore an "int",
+//                                     // but whatever "I" and "ArgTypeT" are on each iteration
+//                                     // - note that we increment zero-based "I" by 1 however
+//                                     // to display it as 1-based since it's more natural for
+//                                     // display purposes):
+//                                     //
+//                                     //    1) int
+//                                     //
+//                                     // Note that we never come through here if the function
+//                                     // represented by "FunctionTraitsT" has no "args (or
+//                                     // variadic args only - variadic args aren't processed)
+//                                     /////////////////////////////////////////////////////////
+//                                     tcout << (I + 1) << _T(") ") << TypeName_v<ArgTypeT> << _T("\n");
+//
+//                                     //////////////////////////////////////////////
+//         // Return true to continue iterating (false
+//         // would stop iterating, equivalent to a
+//         // "break" statement in a regular "for" loop)
+//         //////////////////////////////////////////////
+//         return true;
+//     };
+//
+//     /////////////////////////////////////////////////////////////
+//     // Iterate all tuple elements in "SomeFuncTraits::ArgTypes"
+//     // meaning once for each argument in "SomeFunc()" above.
+//     // Invokes "displayArgType" above for each. Outputs the
+//     // following:
+//     //
+//     //     1) int
+//     //     2) float
+//     //     3) double
+//     //
+//     // Note that "ForEachFunctionTraitsArg()" returns true if
+//     // the functor you pass ("displayArgType" in this example)
+//     // returns true or false otherwise (useful if your functor
+//     // needs to "break" like a normal "for" loop for any
+//     // reason - iteration immediately stops if it returns false
+//     // and the following therefore returns false). Always
+//     // returns true in the above example (and typically in most
+//     // real-world code as well)
+//     /////////////////////////////////////////////////////////////
+//     ForEachFunctionTraitsArg<SomeFuncTraits>(displayArgType);
+/////////////////////////////////////////////////////////////////////////
+template <FUNCTION_TRAITS_C FunctionTraitsT,
+          FOR_EACH_TUPLE_FUNCTOR_C ForEachTupleFunctorT>
+inline constexpr bool ForEachFunctionTraitsArg(ForEachTupleFunctorT&& functor)
+{
+    // See this constant for details
+    #if !CONCEPTS_SUPPORTED
+        /////////////////////////////////////////////////////
+        // Kicks in if concepts not supported, otherwise
+        // FUNCTION_TRAITS_C concept kicks in above instead
+        // (latter simply resolves to the "typename" keyword
+        // when concepts aren't supported)
+        /////////////////////////////////////////////////////
+        STATIC_ASSERT_IS_FUNCTION_TRAITS(FunctionTraitsT);
+
+        ///////////////////////////////////////////////
+        // Kicks in if C++ 17 or earlier, otherwise
+        // FOR_EACH_TUPLE_FUNCTOR_C concept kicks in
+        // above instead (latter simply resolves to
+        // the "typename" keyword in C++17 or earlier)
+        ///////////////////////////////////////////////
+        STATIC_ASSERT_IS_FOR_EACH_TUPLE_FUNCTOR(ForEachTupleFunctorT)
+    #endif
+
+    /////////////////////////////////////////////////////////
+    // Defer to function template "ForEachTupleType()" just
+    // above, specializing it on the tuple type member of
+    // "FunctionTraitsT" (i.e., the "std::tuple" containing
+    // all non-variadic arg types for the function
+    // represented by "FunctionTraitsT"). All tuple types
+    // (i.e., all arg types in the "FunctionTraitsT"
+    // function) are therefore iterated, invoking "functor"
+    // for each (we pass the latter).
+    /////////////////////////////////////////////////////////
+    return ForEachTupleType<FunctionTraitsArgTypes_t<FunctionTraitsT>>(std::forward<ForEachTupleFunctorT>(functor));
+}
+
+///////////////////////////////////////////////////////////////////
+// ForEachArg(). Thin wrapper around "ForEachFunctionTraitsArg()"
+// just above. Simply creates a "FunctionTraits" from the function
+// given by template arg "F" and then invokes the latter function.
+// Therefore iterates all tuple elements corresponding to each
+// (non-variadic) arg in function "F" (or none if "F" has no
+// non-variadic args) and invokes "functor" for each. See above
+// function for further details.
+// 
+// Note that you should normally rely on the following function
+// instead of "ForEachFunctionTraitsArg()" above since it's easier
+// (though you're free to use the latter function if you've already
+// created a "FunctionTraits" for other purposes). The following
+// provides the same example seen in "ForEachFunctionTraitsArg()"
+// to demonstrate this.
+//
+//     Example
+//     -------
+//     ///////////////////////////////////////////////////
+//     // Prototype of some function whose arg types you
+//     // wish to iterate (display in this example - see
+//     // "displayArgType" lambda below). Note that we're
+//     // using a raw C++ function type in this example
+//     // (just a free-function prototype), but pointers
+//     // and references to functions are also supported
+//     // (though references to non-static member functions
+//     // are illegal in C++), as well as references to
+//     // pointers, and non-overloaded functors (or
+//     // references to functors)
+//     ///////////////////////////////////////////////////
+//     int SomeFunc(int arg1, float arg2, double arg3);
+//
+//     /////////////////////////////////////////////////////////////////
+//     // Lambda that will be invoked just below, once for each arg in
+//     // "SomeFunc()" above (where template arg "I" is the zero-based
+//     // "Ith" argument of "SomeFunc()", and "ArgTypeT" is its type).
+//     // Note that lambda templates are supported in C++20 and later
+//     // only. For C++17 (this header doesn't support earlier versions),
+//     // you need to roll your own functor instead (with a template
+//     // version of "operator()" equivalent to this lambda)
+//     /////////////////////////////////////////////////////////////////
+//     const auto displayArgType = []<std::size_t I, typename ArgTypeT>()
+//                                 {
+//                                     //////////////////////////////////////////////////////
+//                                     // Display the type of the (zero-based) "Ith" arg in
+//                                     // "SomeFunc" using the following format (shown here
+//                                     // for "I" equals zero so "ArgTypeT" is therefore an
+//                                     // "int", but whatever "I" and "ArgTypeT" are on each
+//                                     // iteration - note that we increment zero-based "I"
+//                                     // by 1 however to display it as 1-based since it's
+//                                     // more natural for display purposes):
+//                                     //
+//                                     //    1) int
+//                                     //
+//                                     // Note that we never come through here if function
+//                                     // "F" has no args (or variadic args only - variadic
+//                                     // args aren't processed)
+//                                     //////////////////////////////////////////////////////
+//                                     tcout << (I + 1) << _T(") ") << TypeName_v<ArgTypeT> << _T("\n");
+//
+//                                     //////////////////////////////////////////////
+//                                     // Return true to continue iterating (false
+//                                     // would stop iterating, equivalent to a
+//                                     // "break" statement in a regular "for" loop)
+//                                     //////////////////////////////////////////////
+//                                     return true;
+//                                 };
+//
+//     ///////////////////////////////////////////////////////////////
+//     // Iterate all argument types in "SomeFunc", invoking
+//     // "displayArgType" above for each. Outputs the following:
+//     //
+//     //     1) int
+//     //     2) float
+//     //     3) double
+//     //
+//     // Note that "ForEachArg" returns true if the functor you pass
+//     // ("displayArgType" in this example) returns true or false
+//     // otherwise (useful if your functor needs to "break" like a
+//     // normal "for" loop for some reason - iteration immediately
+//     // stops if it returns false and the following therefore
+//     // returns false). Always returns true in the above example
+//     // (and typically in most real-world code as well)
+//     ///////////////////////////////////////////////////////////////
+//     using F = decltype(SomeFunc);
+//     ForEachArg<F>(displayArgType);
 ///////////////////////////////////////////////////////////////////
-// ForEach(). Generic function template effectively equivalent to
-// a "for" loop but used at compile time to execute the given
-// "functor" "N" times (unless the "functor" arg returns false on
-// any of those iterations in which case processing immediately
-// stops and "false" is immediately returned - read on).    
+template <TRAITS_FUNCTION_C F, FOR_EACH_TUPLE_FUNCTOR_C ForEachTupleFunctorT>
+inline constexpr bool ForEachArg(ForEachTupleFunctorT&& functor)
+{
+    // See this constant for details
+    #if !CONCEPTS_SUPPORTED
+        /////////////////////////////////////////////////////
+        // Kicks in if concepts not supported, otherwise
+        // TRAITS_FUNCTION_C concept kicks in above instead
+        // (latter simply resolves to the "typename" keyword
+        // when concepts aren't supported)
+        /////////////////////////////////////////////////////
+        STATIC_ASSERT_IS_TRAITS_FUNCTION(F);
+
+        ///////////////////////////////////////////////
+        // Kicks in if C++ 17 or earlier, otherwise
+        // FOR_EACH_TUPLE_FUNCTOR_C concept kicks in
+        // above instead (latter simply resolves to
+        // the "typename" keyword in C++17 or earlier)
+        ///////////////////////////////////////////////
+        STATIC_ASSERT_IS_FOR_EACH_TUPLE_FUNCTOR(ForEachTupleFunctorT)
+    #endif
+
+    ///////////////////////////////////////////////////////////
+    // Create (specialize) a "FunctionTraits" from "F" and
+    // defer to function template "ForEachFunctionTraitsArg()"
+    // just above (the "FunctionTraits" version of this
+    // function). All non-variadic arg types for the function
+    // represented by "FunctionTraitsT" are therefore iterated,
+    // invoking "functor" for each (we pass the latter).
+    ///////////////////////////////////////////////////////////
+    return ForEachFunctionTraitsArg<FunctionTraits<F>>(std::forward<ForEachTupleFunctorT>(functor));
+}
+
+/////////////////////////////////////////////////////////////////////////
+// Execution policies for "ForEachTupleValue()" and "ForEachArgValue()"
+// declared further below (see these for details). Pass one of the
+// following "constexpr" instances as the 1st (function) arg of either
+// function:
+//
+//    ForEachSequenced   - Elements are processed in order (index 0
+//                         first), and processing stops as soon as the
+//                         functor returns false (the default)
+//    ForEachUnsequenced - All elements are always processed (your
+//                         functor's return value doesn't stop
+//                         processing though it's still returned),
+//                         in no particular order, i.e., the calls for
+//                         each element are indeterminately sequenced
+//                         (each runs to completion before or after the
+//                         others, but the compiler is free to choose
+//                         the order). Your functor's work for each
+//                         element must therefore be independent.
+//    ForEachParallel    - Elements are processed concurrently on the
+//                         threads of a "TaskPool" (see this for
+//                         details), "TaskPool::Default()" unless you
+//                         pass "ForEachParallel.On(yourPool)" instead,
+//                         and on the calling thread itself. Only
+//                         available if STDEXT_USE_THREADS is #defined
+//                         (see this for details). If your functor
+//                         returns false for any element then no
+//                         further elements are started (cooperative
+//                         cancellation - elements already in progress
+//                         still finish). Your functor must be safe to
+//                         invoke concurrently. The pool's threads are
+//                         started once (on first use) and then reused
+//                         by every call, so each call only costs a
+//                         wake-up of the pool's threads, but this is
+//                         still normally only worth it for expensive
+//                         per-element work.
+/////////////////////////////////////////////////////////////////////////
+struct ForEachSequencedPolicy
+{
+};
+
+struct ForEachUnsequencedPolicy
+{
+};
+
+inline constexpr ForEachSequencedPolicy ForEachSequenced{};
+inline constexpr ForEachUnsequencedPolicy ForEachUnsequenced{};
+
+#if defined(STDEXT_USE_THREADS)
+    /////////////////////////////////////////////////////////////////////////
+    // TaskPool. Small pool of persistent worker threads used by the
+    // "ForEachParallel" execution policy (see this for details). The worker
+    // threads are started the first time "Run()" is called (not by the
+    // constructor, so a pool with static storage duration costs nothing
+    // until it's used), and live until the pool is destroyed. The default
+    // pool ("Default()") has one worker per hardware thread other than
+    // the calling one. You can also create your own (with the number of
+    // worker threads of your choice) and pass it via
+    // "ForEachParallel.On(pool)". Each call to "Run()" hands out the
+    // indexes of its jobs one at a time (via an atomic counter) to the
+    // worker threads and the calling thread alike, so whichever thread is
+    // free takes the next job, and "Run()" returns once all jobs are
+    // done. Only one "Run()" is processed by the workers at a time. If the
+    // pool is busy (another thread is calling "Run()", or "Run()" is
+    // called from one of its own jobs), the jobs are simply run on the
+    // calling thread instead (so nested calls never deadlock).
+    /////////////////////////////////////////////////////////////////////////
+    class TaskPool
+    {
+    public:
+        explicit TaskPool(const std::size_t threadCount = DefaultThreadCount()) noexcept
+            : m_ThreadCount(threadCount)
+        {
+        }
+
+        TaskPool(const TaskPool &) = delete;
+        TaskPool &operator=(const TaskPool &) = delete;
+
+        ~TaskPool()
+        {
+            {
+                const std::lock_guard<std::mutex> lock(m_Mutex);
+                m_IsStopping = true;
+            }
+
+            m_WorkReady.notify_all();
+
+            for (std::thread &thread : m_Threads)
+            {
+                thread.join();
+            }
+        }
+
+        ////////////////////////////////////////////////////////////
+        // Pool used by "ForEachParallel" unless you pass your own
+        // (created on first use, and destroyed at program exit)
+        ////////////////////////////////////////////////////////////
+        static TaskPool &Default()
+        {
+            static TaskPool pool;
+            return pool;
+        }
+
+        // One worker per hardware thread (other than the calling thread)
+        static std::size_t DefaultThreadCount() noexcept
+        {
+            const std::size_t hardwareThreads = std::thread::hardware_concurrency();
+            return hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+        }
+
+        // Number of worker threads (not including the thread calling "Run()")
+        std::size_t ThreadCount() const noexcept
+        {
+            return m_ThreadCount;
+        }
+
+        ////////////////////////////////////////////////////////////
+        // Invokes "job(i)" for each "i" from zero to "count - 1"
+        // (in no particular order) on the worker threads and the
+        // calling thread, returning once all are done. "job" must
+        // be "noexcept" (catch any exceptions within it and handle
+        // them after "Run()" returns).
+        ////////////////////////////////////////////////////////////
+        template <typename JobT>
+        void Run(const std::size_t count, JobT &job)
+        {
+            static_assert(noexcept(job(std::size_t())), "\"job\" must be \"noexcept\"");
+
+            std::unique_lock<std::mutex> runLock(m_RunMutex, std::try_to_lock);
+            if (!runLock || count <= 1 || !Start())
+            {
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    job(i);
+                }
+
+                return;
+            }
+
+            {
+                const std::lock_guard<std::mutex> lock(m_Mutex);
+                m_Invoke = [](void *const context, const std::size_t i) noexcept
+                           {
+                               (*static_cast<JobT *>(context))(i);
+                           };
+                m_Context = const_cast<void *>(static_cast<const volatile void *>(std::addressof(job)));
+                m_Count = count;
+                m_Next.store(0, std::memory_order_relaxed);
+                m_BusyCount = m_Threads.size();
+                ++m_Generation;
+            }
+
+            m_WorkReady.notify_all();
+            RunJobs();
+
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_WorkDone.wait(lock, [this] { return m_BusyCount == 0; });
+        }
+
+    private:
+        ////////////////////////////////////////////////////////////
+        // Starts the worker threads if not already started (only
+        // called while "m_RunMutex" is locked). Returns false if
+        // there are none (none requested or none could be
+        // started), in which case "Run()" does all the work itself.
+        ////////////////////////////////////////////////////////////
+        bool Start() noexcept
+        {
+            if (!m_IsStarted)
+            {
+                m_IsStarted = true;
+
+                try
+                {
+                    m_Threads.reserve(m_ThreadCount);
+                    for (std::size_t i = 0; i < m_ThreadCount; ++i)
+                    {
+                        m_Threads.emplace_back(&TaskPool::Work, this);
+                    }
+                }
+                catch (...)
+                {
+                    // Can't start more threads (jobs processed by those that started)
+                }
+            }
+
+            return !m_Threads.empty();
+        }
+
+        // Claims and invokes the current jobs until none are left
+        void RunJobs() noexcept
+        {
+            for (std::size_t i = m_Next.fetch_add(1, std::memory_order_relaxed);
+                 i < m_Count;
+                 i = m_Next.fetch_add(1, std::memory_order_relaxed))
+            {
+                m_Invoke(m_Context, i);
+            }
+        }
+
+        // Worker thread
+        void Work() noexcept
+        {
+            std::size_t generation = 0;
+
+            for (;;)
+            {
+                std::unique_lock<std::mutex> lock(m_Mutex);
+                m_WorkReady.wait(lock, [&] { return m_IsStopping || m_Generation != generation; });
+                if (m_IsStopping)
+                {
+                    return;
+                }
+
+                generation = m_Generation;
+                lock.unlock();
+
+                RunJobs();
+
+                lock.lock();
+                if (--m_BusyCount == 0)
+                {
+                    m_WorkDone.notify_one();
+                }
+            }
+        }
+
+        const std::size_t m_ThreadCount;
+        std::vector<std::thread> m_Threads;
+        bool m_IsStarted = false;
+
+        std::mutex m_RunMutex; // Locked by "Run()" while the workers process its jobs
+        std::mutex m_Mutex; // Protects the members below (except "m_Next")
+        std::condition_variable m_WorkReady;
+        std::condition_variable m_WorkDone;
+        bool m_IsStopping = false;
+        std::size_t m_Generation = 0; // Incremented by each "Run()" handed to the workers
+        std::size_t m_BusyCount = 0; // Workers yet to finish the current "Run()"
+
+        // The current jobs (written by "Run()" before waking the workers)
+        void (*m_Invoke)(void *, std::size_t) noexcept = nullptr;
+        void *m_Context = nullptr;
+        std::size_t m_Count = 0;
+        std::atomic<std::size_t> m_Next{0};
+    };
+
+    struct ForEachParallelPolicy
+    {
+        // Returns a "ForEachParallel" policy that runs on "pool" (instead of "TaskPool::Default()")
+        constexpr ForEachParallelPolicy On(TaskPool &pool) const noexcept
+        {
+            return ForEachParallelPolicy{&pool};
+        }
+
+        TaskPool &Pool() const
+        {
+            return m_Pool ? *m_Pool : TaskPool::Default();
+        }
+
+        TaskPool *m_Pool = nullptr; // "nullptr" for "TaskPool::Default()"
+    };
+
+    inline constexpr ForEachParallelPolicy ForEachParallel{};
+#endif
+
+///////////////////////////////////////////////////////////////////////////
+// For internal use only (by "ForEachTupleValue()" just after this
+// namespace)
+///////////////////////////////////////////////////////////////////////////
+STDEXT_BEGIN_PRIVATE
+{
+    ///////////////////////////////////////////////////////////////////////
+    // Invokes "functor" for element "I" of "tuple" (perfect forwarding
+    // the element so it's moved from an rvalue tuple)
+    ///////////////////////////////////////////////////////////////////////
+    template <std::size_t I, typename TupleT, typename ForEachValueFunctorT>
+    inline constexpr bool ForEachTupleValueInvoke(TupleT &&tuple, ForEachValueFunctorT &&functor)
+    {
+        return static_cast<bool>(std::forward<ForEachValueFunctorT>(functor).template operator()<I>(std::get<I>(std::forward<TupleT>(tuple))));
+    }
+
+    template <typename TupleT, typename ForEachValueFunctorT, std::size_t... Is>
+    inline constexpr bool ForEachTupleValueImpl(ForEachSequencedPolicy,
+                                                TupleT &&tuple,
+                                                ForEachValueFunctorT &&functor,
+                                                std::index_sequence<Is...>)
+    {
+        // "&&" always short-circuits left to right (see "ForEachImpl()")
+        return (ForEachTupleValueInvoke<Is>(std::forward<TupleT>(tuple), std::forward<ForEachValueFunctorT>(functor)) && ...);
+    }
+
+    template <typename TupleT, typename ForEachValueFunctorT, std::size_t... Is>
+    inline constexpr bool ForEachTupleValueImpl(ForEachUnsequencedPolicy,
+                                                TupleT &&tuple,
+                                                ForEachValueFunctorT &&functor,
+                                                std::index_sequence<Is...>)
+    {
+        ///////////////////////////////////////////////////////////
+        // Note that unlike "&&", the operands of "&" are always
+        // all evaluated, and in no particular order. Since each
+        // operand is a function call the calls are
+        // indeterminately sequenced (never interleaved, but the
+        // compiler is free to choose their order). Also note the
+        // "true" at the end, which handles the empty case
+        // (returns "true").
+        ///////////////////////////////////////////////////////////
+        return (ForEachTupleValueInvoke<Is>(std::forward<TupleT>(tuple), std::forward<ForEachValueFunctorT>(functor)) & ... & true);
+    }
+
+    #if defined(STDEXT_USE_THREADS)
+        template <typename TupleT, typename ForEachValueFunctorT, std::size_t... Is>
+        inline bool ForEachTupleValueImpl(const ForEachParallelPolicy policy,
+                                          TupleT &&tuple,
+                                          ForEachValueFunctorT &&functor,
+                                          std::index_sequence<Is...>)
+        {
+            constexpr std::size_t N = sizeof...(Is);
+
+            if constexpr (N == 0)
+            {
+                return true;
+            }
+            else
+            {
+                ////////////////////////////////////////////////////////
+                // One task per element. Since the elements are
+                // (normally) of different types, each task is a
+                // separate function (specialized on its index "I"),
+                // and all tasks are called through a common function
+                // pointer type so they can be claimed by any thread.
+                ////////////////////////////////////////////////////////
+                using Task = bool (*)(TupleT &&, ForEachValueFunctorT &);
+                constexpr Task tasks[] = {[](TupleT &&tuple, ForEachValueFunctorT &functor)
+                                          {
+                                              return ForEachTupleValueInvoke<Is>(std::forward<TupleT>(tuple), functor);
+                                          }...};
+
+                ////////////////////////////////////////////////////////
+                // Each job (one per element) is claimed by whichever
+                // thread of the pool (or the calling thread) is free
+                // (see "TaskPool::Run()"). Once processing has been
+                // cancelled (via "stop", set when "functor" returns
+                // false or throws), jobs not yet started do nothing.
+                // Exceptions are stored per element and the first is
+                // rethrown once all jobs have finished.
+                ////////////////////////////////////////////////////////
+                std::atomic<bool> stop(false);
+                std::exception_ptr exceptions[N];
+
+                const auto job = [&](const std::size_t i) noexcept
+                                 {
+                                     if (stop.load(std::memory_order_relaxed))
+                                     {
+                                         return;
+                                     }
+
+                                     try
+                                     {
+                                         if (!tasks[i](std::forward<TupleT>(tuple), functor))
+                                         {
+                                             stop.store(true, std::memory_order_relaxed);
+                                         }
+                                     }
+                                     catch (...)
+                                     {
+                                         exceptions[i] = std::current_exception();
+                                         stop.store(true, std::memory_order_relaxed);
+                                     }
+                                 };
+
+                policy.Pool().Run(N, job);
+
+                for (const std::exception_ptr &exception : exceptions)
+                {
+                    if (exception)
+                    {
+                        std::rethrow_exception(exception);
+                    }
+                }
+
+                return !stop.load(std::memory_order_relaxed);
+            }
+        }
+    #endif
+} // namespace Private
+STDEXT_END_PRIVATE
+
+///////////////////////////////////////////////////////////////////////////
+// ForEachTupleValue(). Runtime counterpart of "ForEachTupleType()" which
+// visits the values stored in "tuple" instead of just its types (where
+// "tuple" is a "std::tuple" or any other tuple-like type supported by
+// "std::get()" and "std::tuple_size", such as "std::pair" or
+// "std::array"). "functor" is invoked once for each element of "tuple",
+// in the manner specified by "policy" ("ForEachSequenced",
+// "ForEachUnsequenced" or "ForEachParallel" - see these for details).
+// Its "operator()" must be declared as follows, where "I" is the
+// (zero-based) index of the element, and "value" is the element itself
+// (perfect forwarded from "tuple"):
+//
+//     template <std::size_t I, typename ValueT>
+//     bool operator()(ValueT &&value) const;
+//
+// Return true to continue processing (or false to stop, as for
+// "ForEachTupleType()" - "ForEachUnsequenced" processes all elements
+// regardless however). Returns false if "functor" returned false for
+// any element processed, or true otherwise (including when "tuple" is
+// empty).
+//
+//     Example
+//     -------
+//     std::tuple<int, std::string, double> values(1, "Hello", 2.5);
+//
+//     ///////////////////////////////////////////////////////////
+//     // Functor invoked for each value in "values" (in C++20 or
+//     // later you can pass a lambda template instead, i.e.,
+//     // "[]<std::size_t I, typename ValueT>(ValueT &&value)")
+//     ///////////////////////////////////////////////////////////
+//     struct Validate
+//     {
+//         template <std::size_t I, typename ValueT>
+//         bool operator()(ValueT &&value) const
+//         {
+//             return IsValid(value);
+//         }
+//     };
+//
+//     const bool allValid = ForEachTupleValue(ForEachUnsequenced, values, Validate());
+///////////////////////////////////////////////////////////////////////////
+template <typename PolicyT,
+          typename TupleT,
+          typename ForEachValueFunctorT>
+inline constexpr bool ForEachTupleValue(PolicyT policy, TupleT &&tuple, ForEachValueFunctorT &&functor)
+{
+    return Private::ForEachTupleValueImpl(policy,
+                                          std::forward<TupleT>(tuple),
+                                          std::forward<ForEachValueFunctorT>(functor),
+                                          std::make_index_sequence<std::tuple_size_v<RemoveCvRef<TupleT>>>());
+}
+
+///////////////////////////////////////////////////////////////////////////
+// ForEachTupleValue(). Overload of the function just above that always
+// uses the "ForEachSequenced" policy. See above for details.
+///////////////////////////////////////////////////////////////////////////
+template <typename TupleT,
+          typename ForEachValueFunctorT>
+inline constexpr bool ForEachTupleValue(TupleT &&tuple, ForEachValueFunctorT &&functor)
+{
+    return ForEachTupleValue(ForEachSequenced, std::forward<TupleT>(tuple), std::forward<ForEachValueFunctorT>(functor));
+}
+
+///////////////////////////////////////////////////////////////////////////
+// ForEachArgValue(). Same as "ForEachTupleValue()" just above but
+// "args" stores one value for each (non-variadic) argument in function
+// "F" (such as a batch of decoded arguments for "F"), so the number of
+// elements in "args" must match "ArgCount_v<F>" (a "static_assert"
+// occurs otherwise). Element "I" of "args" is normally (but not
+// necessarily) of type "RemoveCvRef<ArgType_t<F, I>>" See
+// "ForEachTupleValue()" for details.
+///////////////////////////////////////////////////////////////////////////
+template <TRAITS_FUNCTION_C F,
+          typename PolicyT,
+          typename ArgsTupleT,
+          typename ForEachValueFunctorT>
+inline constexpr bool ForEachArgValue(PolicyT policy, ArgsTupleT &&args, ForEachValueFunctorT &&functor)
+{
+    // See this constant for details
+    #if !CONCEPTS_SUPPORTED
+        /////////////////////////////////////////////////////
+        // Kicks in if concepts not supported, otherwise
+        // TRAITS_FUNCTION_C concept kicks in above instead
+        // (latter simply resolves to the "typename" keyword
+        // when concepts aren't supported)
+        /////////////////////////////////////////////////////
+        STATIC_ASSERT_IS_TRAITS_FUNCTION(F);
+    #endif
+
+    static_assert(std::tuple_size_v<RemoveCvRef<ArgsTupleT>> == ArgCount_v<F>,
+                  "\"args\" must have one element for each (non-variadic) argument of \"F\"");
+
+    return ForEachTupleValue(policy, std::forward<ArgsTupleT>(args), std::forward<ForEachValueFunctorT>(functor));
+}
+
+///////////////////////////////////////////////////////////////////////////
+// ForEachArgValue(). Overload of the function just above that always
+// uses the "ForEachSequenced" policy. See above for details.
+///////////////////////////////////////////////////////////////////////////
+template <TRAITS_FUNCTION_C F,
+          typename ArgsTupleT,
+          typename ForEachValueFunctorT>
+inline constexpr bool ForEachArgValue(ArgsTupleT &&args, ForEachValueFunctorT &&functor)
+{
+    return ForEachArgValue<F>(ForEachSequenced, std::forward<ArgsTupleT>(args), std::forward<ForEachValueFunctorT>(functor));
+}
+
+///////////////////////////////////////////////////////////////////////////
+// For internal use only (by "InvokeWithDecoder()" just after this
+// namespace)
+///////////////////////////////////////////////////////////////////////////
+STDEXT_BEGIN_PRIVATE
+{
+    ///////////////////////////////////////////////////////////////////////
+    // InvokeWithDecoderImpl(). Invokes "function" (a free function or
+    // functor), passing the result of "decoder.operator()<I, ArgTypeT>()"
+    // for each (non-variadic) arg "I" in "F" directly as the argument
+    // itself (where "ArgTypeT" is the arg's type). See
+    // "InvokeWithDecoder()" for details.
+    ///////////////////////////////////////////////////////////////////////
+    template <typename F,
+              typename FunctionT,
+              typename DecoderT,
+              std::size_t... Is>
+    inline constexpr decltype(auto) InvokeWithDecoderImpl(FunctionT &&function,
+                                                          DecoderT &decoder,
+                                                          std::index_sequence<Is...>)
+        noexcept(noexcept(std::forward<FunctionT>(function)(decoder.template operator()<Is, ArgType_t<F, Is>>()...)))
+    {
+        return std::forward<FunctionT>(function)(decoder.template operator()<Is, ArgType_t<F, Is>>()...);
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // MemberFunctionObject(). Returns the object a non-static member
+    // function is invoked on given "object", a (raw) pointer to the
+    // object (which is dereferenced) or a reference to it (returned
+    // as-is, so its value category is preserved)
+    ///////////////////////////////////////////////////////////////////////
+    template <typename ObjectT>
+    inline constexpr decltype(auto) MemberFunctionObject(ObjectT &&object) noexcept
+    {
+        if constexpr (std::is_pointer_v<RemoveCvRef<ObjectT>>)
+        {
+            return *object;
+        }
+        else
+        {
+            return std::forward<ObjectT>(object);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // InvokeMemberWithDecoderImpl(). Same as "InvokeWithDecoderImpl()"
+    // just above but for non-static member functions, invoked on
+    // "object" (a reference or pointer to an object of the member
+    // function's class - see "MemberFunctionObject()" just above).
+    ///////////////////////////////////////////////////////////////////////
+    template <typename F,
+              typename FunctionT,
+              typename ObjectT,
+              typename DecoderT,
+              std::size_t... Is>
+    inline constexpr decltype(auto) InvokeMemberWithDecoderImpl(FunctionT function,
+                                                                ObjectT &&object,
+                                                                DecoderT &decoder,
+                                                                std::index_sequence<Is...>)
+        noexcept(noexcept((MemberFunctionObject(std::forward<ObjectT>(object)).*function)(decoder.template operator()<Is, ArgType_t<F, Is>>()...)))
+    {
+        return (MemberFunctionObject(std::forward<ObjectT>(object)).*function)(decoder.template operator()<Is, ArgType_t<F, Is>>()...);
+    }
+} // namespace Private
+STDEXT_END_PRIVATE
+
+/////////////////////////////////////////////////////////////////////////////
+// InvokeWithDecoder(). Invokes "function" (a free function, pointer or
+// reference to a free function, or a functor), where each of its
+// (non-variadic) arguments is produced by "decoder" directly in the call
+// expression itself. No intermediate "std::tuple" (or any other
+// temporary storage) is ever created for the arguments, unlike the
+// usual technique of decoding all arguments into a "std::tuple" first
+// and then calling "std::apply()". "decoder" must be a functor with the
+// following template member (similar to the functor you pass to
+// "ForEachArg()" but it returns the arg itself instead of a "bool"),
+// which is invoked once for each (non-variadic) arg in "function",
+// where "I" is the (zero-based) index of the arg and "ArgTypeT" is its
+// type (as given by "ArgType_t<F, I>"):
+//
+//     template <std::size_t I, typename ArgTypeT>
+//     ArgTypeT operator()();
 //
-// Note that "operator()" in your functor must be declared as follows
-// (and will typically be "const" as seen though it can be non-const
-// as well if required, and/or noexcept as well)
+// Since "operator()" returns (exactly) "ArgTypeT", when the arg is
+// passed by value the returned prvalue initializes the function's
+// parameter directly (C++17 guaranteed copy elision so no copies or
+// moves ever occur), and when the arg is a reference (lvalue or rvalue),
+// the returned reference binds to the parameter directly (so it's
+// forwarded as-is). The call is "noexcept" if "function" is (i.e.,
+// "IsNoexcept_v<F>" is true) and every call to "decoder" is "noexcept"
+// as well. The return value of "function" itself is returned as-is
+// (by "decltype(auto)" so references are preserved).
 //
-//     template <std::size_t I>
-//     bool operator()() const
+// IMPORTANT:
+// ---------
+// Note that C++ doesn't guarantee the order in which function arguments
+// are evaluated so "decoder" may be invoked in any order. It should
+// therefore decode each arg based on its index "I" (e.g., from a known
+// offset in a wire buffer), not on the order in which it's called.
+//
+//     Example
+//     -------
+//     struct Decoder
 //     {
-//         // Process "I" accordingly
+//         const unsigned char *m_Buffer;
 //
-//         /////////////////////////////////////////////////////
-//         // "true" means continue processing so this function
-//         // will immediately be called again specialized on
-//         // "I + 1" until "N" is reached (EXclusive). Return
-//         // false instead to immediately stop processing
-//         // (equivalent to a "break" statement in a regular
-//         // "for" loop)
-//         /////////////////////////////////////////////////////
-//         return true;
-//     }
+//         template <std::size_t I, typename ArgTypeT>
+//         ArgTypeT operator()() const noexcept
+//         {
+//             // Read arg "I" of type "ArgTypeT" from "m_Buffer" ...
+//         }
+//     };
 //
-// "ForEach()" effectively stamps out "N" copies of "operator()"
-// above, once for each "I" in the range 0 to N - 1 inclusive
-// (unless "N" is zero in which case "operator()" is still stamped
-// out for "I" equal zero but never actually called - it's only
-// stamped out to validate that "ForEachFunctorT" is a valid
-// template arg but this means your functor shouldn't do anything
-// that might be illegal when "N" is zero, like invoke
-// "std::tuple_element_t" for instance, since index zero would be
-// illegal in this case so compilation will fail). In any case,
-// note that your functor should return true as seen above unless
-// you wish to "break" like in a normal "for" loop, in which case
-// it should return false. Either value (true or false) is
-// ultimately returned by the function. If true then "I" is simply
-// incremented by 1 and "operator()" is immediately called again
-// with the newly incremented "I" (stamping out a new copy of
-// "operator()" with the newly incremented "I"). If false then
-// processing immediately exits instead and no new copies of
-// "operator()" are stamped out (for "I + 1" and beyond).
+//     int SomeFunc(int, float, double) noexcept;
 //
-//    Example (iterates all elements of a "std::tuple" but
-//             see the helper function "ForEachTupleType()"
-//             declared later which wraps the following so
-//             it's cleaner - for tuples you should rely
-//             on it instead normally but it ultimately
-//             just defers to "ForEach()" anyway)
-//    -----------------------------------------------------
-//    std::Tuple<int, float, double> myTuple; // Tuple with 3 elements whose types we wish to iterate (and display)
-//    using TupleT = decltype(myTuple); // Type of the above tuple
-// 
-//    //////////////////////////////////////////////////////
-//    // Lambda (template) stamped out and invoked 3 times
-//    // by "ForEach()" below (for I=0, I=1 and I=2). See
-//    // "ForEach()" comments below.
-//    //////////////////////////////////////////////////////
-//    const auto displayTupleElement = []<std::size_t I>()
-//                                     {
-//                                         // Type of the this tuple element (for the current "I")
-//                                         using TupleElement_t = std::tuple_element_t<I, TupleT>;
-// 
-//                                         /////////////////////////////////////////////////
-//                                         // Displays (literally) "int" when I=0, "float"
-//                                         // when I=1 and "double" when I=2 (for this
-//                                         // particular tuple - see "myTuple above)
-//                                         /////////////////////////////////////////////////
-//                                         std::cout << TypeName_v<TupleElement_t> << "\n";
-//        
-//                                         //////////////////////////////////////////////
-//                                         // Return false here instead if you need to
-//                                         // stop processing (equivalent to "break" in
-//                                         // a normal "for" loop). Returning "true"
-//                                         // insteaad as we're doing here means all
-//                                         // tuple elements will be processed.
-//                                         //////////////////////////////////////////////
-//                                         return true;
-//                                     };
+//     const int result = InvokeWithDecoder(SomeFunc, Decoder{buffer});
 //
-//     ///////////////////////////////////////////////////////////////////
-//     // Call "ForEach()" which iterates (effectively does a "foreach")
-//     // of the above lambda "N" times, where "N" is explicitly passed
-//     // as the 1st template arg to "ForEach()" (the number of elements
-//     // in our tuple, 3 in this case), and the 2nd template arg, the
-//     // type of the functor, "ForEachFunctorT", is implicitly deduced
-//     // from the arg itself. We're passing "displayTupleElement" so
-//     // the 2nd template arg is implicitly deduced to the type of this
-//     // functor, i.e., whatever class the compiler generates for the
-//     // above lambda behind the scenes (recall that a lambda is just
-//     // syntactic sugar for a compiler-generated functor). The upshot
-//     // is that "operator()" in this functor (the above lambda) is
-//     // effectively stamped out 3 times and invoked for each (for I=0,
-//     // I=1 and I=2)
-//     ///////////////////////////////////////////////////////////////////
-//     ForEach<std::tuple_size_v<TupleT>>(displayTupleElement);
-///////////////////////////////////////////////////////////////////
-template <std::size_t N, FOR_EACH_FUNCTOR_C ForEachFunctorT>
-inline constexpr bool ForEach(ForEachFunctorT&& functor)
+// Lastly, note that for non-static member functions, see the overload
+// just below (which also takes the object to invoke the function on).
+/////////////////////////////////////////////////////////////////////////////
+template <TRAITS_FUNCTION_C F,
+          typename DecoderT>
+inline constexpr decltype(auto) InvokeWithDecoder(F &&function, DecoderT &&decoder)
+    noexcept(noexcept(Private::InvokeWithDecoderImpl<RemoveCvRef<F>>(std::forward<F>(function),
+                                                                     decoder,
+                                                                     std::make_index_sequence<ArgCount_v<RemoveCvRef<F>>>())))
 {
-    // Lambda templates not supported until C++20
-    #if CPP20_OR_LATER
-        ////////////////////////////////////////////////////////////
-        // Lambda template we'll be calling "N" times for the given
-        // template arg "N" in "ForEach()" (the function you're now
-        // reading). Each iteration invokes "functor", where
-        // processing stops after "N" calls to "functor" or 
-        // "functor" returns false, whichever comes first (false only
-        // returned if "functor" wants to break like a normal "for"
-        // loop, which rarely happens in practice so we usually
-        // iterate "N" times)
-        //
-        // IMPORTANT:
-        // ---------
-        // The parameter "functor" (we'll call this the "outer"
-        // functor) is always a reference type so it's always of
-        // the form "T&" or "T&&". The following lambda captures it
-        // by (lvalue) reference as seen so it effectively creates
-        // an (lvalue) reference (member) variable that either
-        // looks like this:
-        //
-        //     T& &functor;
-        //
-        // or this:
-        //
-        //     T&& &functor;
-        //
-        // We'll call this the "inner" functor. In either case
-        // however the usual reference collapsing rules then kick
-        // in so it always resolves to this (Google for these
-        // rules if you're not already familiar):
-        //
-        //     T& functor;
-        //
-        // IOW, the inner "functor" is always an lvalue reference
-        // inside the lambda even when the outer "functor" is an
-        // rvalue reference. We therefore need to invoke
-        // "std::forward" on it in the lambda below so that we get
-        // back the correct "&" or "&&" reference of the outer
-        // "functor" itself, which we then invoke in the correct
-        // "&" or "&&" context below. See comments below.
-        ////////////////////////////////////////////////////////////
-        const auto process = [&functor]<std::size_t I>
-                             (const auto &process)
-                             {
-                                 if constexpr (I < N)
-                                 {
-                                     //////////////////////////////////////////////////////////
-                                     // See comments above. We call "std::forward()" here to
-                                     // convert the inner "functor" back to the correct "&" or
-                                     // "&&" reference type of the outer "functor" (note that
-                                     // the inner "functor" member variable we're working with
-                                     // here is always an lvalue reference as described in the
-                                     // comments above). We then immediately invoke the
-                                     // functor in this context noting that it wouldn't work
-                                     // correctly in the "&&" case if we assigned the return
-                                     // value of "std::forward" to a variable first and then
-                                     // invoked the functor. We need to invoke the functor
-                                     // using the return value of "std::forward" directly,
-                                     // on-the-fly as seen. If we assigned it to a variable
-                                     // first instead then in the "&&" case we'd have a
-                                     // variable of type "&&" but since the variable has a
-                                     // name it would be an lvalue, since named variables are
-                                     // always lvalues (even for "&&" reference variables).
-                                     // Invoking the functor on that lvalue variable would
-                                     // therefore call the functor in the context of an
-                                     // lvalue, not an rvalue which is what we require (so,
-                                     // for instance, if the "operator()" member of "functor"
-                                     // has an "&&" reference qualifier, though this would be
-                                     // rare in practice but still always possible, a compiler
-                                     // error would occur since we'd be attempting to call
-                                     // that function using an lvalue which isn't legal -
-                                     // doing it using the rvalue returned directly by
-                                     // "std::forward()" works correctly).
-                                     //////////////////////////////////////////////////////////
-                                     if (std::forward<ForEachFunctorT>(functor).template operator()<I>())
-                                     {
-                                         ////////////////////////////////////////////////
-                                         // Recursive call (in spirit anyway - actually
-                                         // stamps out and runs another version of this
-                                         // function specialized on I + 1)
-                                         ////////////////////////////////////////////////
-                                         return process.template operator()<I + 1>(process);
-                                     }
-                                     else
-                                     {
-                                         return false;
-                                     }
-                                 }
-                                 else
-                                 {
-                                     return true;
-                                 }
-                             };
+    // See this constant for details
+    #if !CONCEPTS_SUPPORTED
+        /////////////////////////////////////////////////////
+        // Kicks in if concepts not supported, otherwise
+        // TRAITS_FUNCTION_C concept kicks in above instead
+        // (latter simply resolves to the "typename" keyword
+        // when concepts aren't supported)
+        /////////////////////////////////////////////////////
+        STATIC_ASSERT_IS_TRAITS_FUNCTION(F);
+    #endif
 
-        return process.template operator()<0>(process);
-    #else
-        STATIC_ASSERT_IS_FOR_EACH_FUNCTOR(ForEachFunctorT);
+    using FunctionT = RemoveCvRef<F>;
+
+    static_assert(IsFreeFunction_v<FunctionT> || IsFunctor_v<FunctionT>,
+                  "\"function\" must be a free function or functor (for non-static member functions "
+                  "call the overload taking the object to invoke the function on)");
+
+    return Private::InvokeWithDecoderImpl<FunctionT>(std::forward<F>(function),
+                                                     decoder,
+                                                     std::make_index_sequence<ArgCount_v<FunctionT>>());
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// InvokeWithDecoder(). Overload of the function just above for non-static
+// member functions, where "function" is a pointer to the member function
+// and "object" is the object to invoke it on (a reference or raw pointer
+// to an object of the function's class, i.e., "MemberFunctionClass_t<F>",
+// or a class derived from it). A reference is perfect forwarded so the
+// member function's ref-qualifier (if any) is respected (i.e., pass an
+// rvalue to invoke a "&&" qualified member function), while a pointer is
+// always dereferenced to an lvalue (as with "std::invoke()"). See the
+// overload above for details.
+/////////////////////////////////////////////////////////////////////////////
+template <TRAITS_FUNCTION_C F,
+          typename ObjectT,
+          typename DecoderT>
+inline constexpr decltype(auto) InvokeWithDecoder(F function, ObjectT &&object, DecoderT &&decoder)
+    noexcept(noexcept(Private::InvokeMemberWithDecoderImpl<F>(function,
+                                                              std::forward<ObjectT>(object),
+                                                              decoder,
+                                                              std::make_index_sequence<ArgCount_v<F>>())))
+{
+    // See this constant for details
+    #if !CONCEPTS_SUPPORTED
+        /////////////////////////////////////////////////////
+        // Kicks in if concepts not supported, otherwise
+        // TRAITS_FUNCTION_C concept kicks in above instead
+        // (latter simply resolves to the "typename" keyword
+        // when concepts aren't supported)
+        /////////////////////////////////////////////////////
+        STATIC_ASSERT_IS_TRAITS_FUNCTION(F);
+    #endif
+
+    static_assert(IsMemberFunction_v<F> && !IsFunctor_v<F>,
+                  "\"function\" must be a pointer to a non-static member function");
+
+    return Private::InvokeMemberWithDecoderImpl<F>(function,
+                                                   std::forward<ObjectT>(object),
+                                                   decoder,
+                                                   std::make_index_sequence<ArgCount_v<F>>());
+}
+
+///////////////////////////////////////////////////////////////////////////
+// For internal use only (by "ArgMarshaller" just after this namespace)
+///////////////////////////////////////////////////////////////////////////
+STDEXT_BEGIN_PRIVATE
+{
+    ///////////////////////////////////////////////////////////////////////
+    // ArgMarshallerNotSpecialized. Base class of the "ArgMarshaller"
+    // primary template, so "ArgLayout" can tell whether it has been
+    // specialized for a given type
+    ///////////////////////////////////////////////////////////////////////
+    struct ArgMarshallerNotSpecialized
+    {
+    };
+} // namespace Private
+STDEXT_END_PRIVATE
+
+/////////////////////////////////////////////////////////////////////////////
+// ArgMarshaller (primary template). Customization point used by
+// "ArgLayout" (see this for details) to serialize and deserialize args
+// that aren't trivially copyable (or that are pointers, which can't be
+// passed to another process), where "T" is the arg's type (after removing
+// any reference and cv-qualifiers). Specialize it for each such type you
+// pass (the primary template just triggers a "static_assert"), providing
+// the following static members:
+//
+//     // Number of bytes "Write()" will write for "value"
+//     static std::size_t Size(const T &value);
+//
+//     // Writes "value" to "buffer" ("Size(value)" bytes)
+//     static void Write(const T &value, std::byte *buffer);
+//
+//     // Returns the value written by "Write()" to "buffer" ("size" bytes)
+//     static T Read(const std::byte *buffer, std::size_t size);
+//
+// Note that "Read()" may return a type other than "T" if it's implicitly
+// convertible to it (and to the arg itself). The bytes written by "Write()"
+// start at an offset that's a multiple of "alignof(T)" (relative to the
+// start of the buffer). You can also specialize it for trivially copyable
+// types that shouldn't be copied byte for byte (such as those containing
+// pointers), since a specialization always takes precedence. A
+// specialization for "std::basic_string_view" is provided just below for
+// instance, which "Read()" returns as a view of the buffer itself (so the
+// characters are never copied).
+/////////////////////////////////////////////////////////////////////////////
+template <typename T,
+          typename = void> // For "std::enable_if_t" purposes in your own specializations
+struct ArgMarshaller : Private::ArgMarshallerNotSpecialized
+{
+};
+
+/////////////////////////////////////////////////////////////////////////////
+// "ArgMarshaller" partial specialization for "std::basic_string_view"
+// (see primary template just above for details). The characters are
+// written as-is (no null terminator), and "Read()" returns a view of them
+// in the buffer itself (so the buffer must outlive the view).
+/////////////////////////////////////////////////////////////////////////////
+template <typename CharT,
+          typename CharTraitsT>
+struct ArgMarshaller<std::basic_string_view<CharT, CharTraitsT>>
+{
+    using StringViewT = std::basic_string_view<CharT, CharTraitsT>;
+
+    static std::size_t Size(const StringViewT &value) noexcept
+    {
+        return value.size() * sizeof(CharT);
+    }
+
+    static void Write(const StringViewT &value, std::byte *buffer) noexcept
+    {
+        if (!value.empty())
+        {
+            std::memcpy(buffer, value.data(), Size(value));
+        }
+    }
+
+    static StringViewT Read(const std::byte *buffer, std::size_t size) noexcept
+    {
+        return StringViewT(reinterpret_cast<const CharT *>(buffer), size / sizeof(CharT));
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////
+// For internal use only (by "ArgLayout" just after this namespace)
+///////////////////////////////////////////////////////////////////////////
+STDEXT_BEGIN_PRIVATE
+{
+    ///////////////////////////////////////////////////////////////////////
+    // HasArgMarshaller_v. "true" if "ArgMarshaller" has been specialized
+    // for "T" (see this for details), or "false" otherwise
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T>
+    inline constexpr bool HasArgMarshaller_v = !std::is_base_of_v<ArgMarshallerNotSpecialized, ArgMarshaller<T>>;
+
+    ///////////////////////////////////////////////////////////////////////
+    // IsWireTrivial_v. "true" if "T" (an arg's type after removing any
+    // reference and cv-qualifiers) is copied into an "ArgLayout" buffer
+    // byte for byte, i.e., it's trivially copyable, not a pointer (to an
+    // object, function or member), and "ArgMarshaller" hasn't been
+    // specialized for it, or "false" otherwise (in which case its
+    // "ArgMarshaller" is used instead)
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T>
+    inline constexpr bool IsWireTrivial_v = std::is_trivially_copyable_v<T> &&
+                                            !std::is_pointer_v<T> &&
+                                            !std::is_member_pointer_v<T> &&
+                                            !std::is_null_pointer_v<T> &&
+                                            !HasArgMarshaller_v<T>;
+
+    ///////////////////////////////////////////////////////////////////////
+    // Marshaller_t. The "ArgMarshaller" for "T" (which must be
+    // specialized since "T" isn't "IsWireTrivial_v")
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T>
+    struct Marshaller
+    {
+        static_assert(HasArgMarshaller_v<T>, "\"T\" isn't trivially copyable (or it's a pointer) so \"ArgLayout\" can't "
+                                             "serialize it. Specialize \"StdExt::ArgMarshaller\" for it (see this for details)");
+
+        using Type = ArgMarshaller<T>;
+    };
+
+    template <typename T>
+    using Marshaller_t = typename Marshaller<T>::Type;
+
+    ///////////////////////////////////////////////////////////////////////
+    // ArgExtent. Stored in the slot of each arg that isn't
+    // "IsWireTrivial_v" (see this just above) in an "ArgLayout" buffer,
+    // the offset (from the start of the buffer) and size of the bytes
+    // written by its "ArgMarshaller" (which follow the fixed-size part of
+    // the buffer). 32 bit members so the layout is the same on 32 and 64
+    // bit platforms.
+    ///////////////////////////////////////////////////////////////////////
+    struct ArgExtent
+    {
+        std::uint32_t m_Offset;
+        std::uint32_t m_Size;
+    };
+
+    template <typename T>
+    inline constexpr std::size_t ArgSlotSize_v = IsWireTrivial_v<T> ? sizeof(T) : sizeof(ArgExtent);
+
+    template <typename T>
+    inline constexpr std::size_t ArgSlotAlignment_v = IsWireTrivial_v<T> ? alignof(T) : alignof(ArgExtent);
+
+    inline constexpr std::size_t AlignUp(std::size_t value, std::size_t alignment) noexcept
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // ArgLayoutTable. The (compile-time) layout of the fixed-size part of
+    // an "ArgLayout" buffer for "N" args, i.e., the offset of each arg's
+    // slot (plus an unused trailing element so the array is never empty),
+    // and the size, alignment and padding of the fixed-size part as a
+    // whole
+    ///////////////////////////////////////////////////////////////////////
+    template <std::size_t N>
+    struct ArgLayoutTable
+    {
+        std::size_t m_Offsets[N + 1];
+        std::size_t m_Size;
+        std::size_t m_Alignment;
+        std::size_t m_Padding;
+    };
+
+    ///////////////////////////////////////////////////////////////////////
+    // MakeArgLayoutTable(). Creates the "ArgLayoutTable" for args of type
+    // "ArgsT" (each after removing any reference and cv-qualifiers). The
+    // slots are laid out in order of decreasing alignment (and in their
+    // original order for equal alignments), so no padding ever occurs
+    // between slots (since the size of each type is always a multiple of
+    // its alignment), only at the end (to round the size up to a multiple
+    // of the largest alignment). Always called at compile time.
+    ///////////////////////////////////////////////////////////////////////
+    template <typename... ArgsT>
+    inline constexpr ArgLayoutTable<sizeof...(ArgsT)> MakeArgLayoutTable() noexcept
+    {
+        constexpr std::size_t N = sizeof...(ArgsT);
+        constexpr std::size_t sizes[] = {ArgSlotSize_v<ArgsT>..., 0};
+        constexpr std::size_t alignments[] = {ArgSlotAlignment_v<ArgsT>..., 1};
+
+        ArgLayoutTable<N> table{};
+        bool placed[N + 1] = {};
+        std::size_t offset = 0;
+        std::size_t used = 0;
+        std::size_t maxAlignment = 1;
+
+        for (std::size_t count = 0; count < N; ++count)
+        {
+            std::size_t next = N;
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                if (!placed[i] && (next == N || alignments[i] > alignments[next]))
+                {
+                    next = i;
+                }
+            }
+
+            placed[next] = true;
+            offset = AlignUp(offset, alignments[next]);
+            table.m_Offsets[next] = offset;
+            offset += sizes[next];
+            used += sizes[next];
+
+            if (alignments[next] > maxAlignment)
+            {
+                maxAlignment = alignments[next];
+            }
+        }
+
+        table.m_Alignment = maxAlignment;
+        table.m_Size = AlignUp(offset, maxAlignment);
+        table.m_Padding = table.m_Size - used;
+
+        return table;
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // ArgLayoutImpl (primary template). Implements "ArgLayout" declared
+    // just after this namespace (which just derives from the partial
+    // specialization below), specialized on "ArgTypeList_t<F>" so that
+    // the function's argument types are available as a parameter pack
+    ///////////////////////////////////////////////////////////////////////
+    template <typename F,
+              typename ArgTypeListT = ArgTypeList_t<F>>
+    class ArgLayoutImpl;
+
+    template <typename F,
+              typename... ArgsT>
+    class ArgLayoutImpl<F, TypeList<ArgsT...>>
+    {
+        static constexpr ArgLayoutTable<sizeof...(ArgsT)> Table = MakeArgLayoutTable<RemoveCvRef<ArgsT>...>();
+
+    public:
+        // Number of (non-variadic) args in "F"
+        static constexpr std::size_t ArgCount = sizeof...(ArgsT);
+
+        // "true" if every arg is stored in its slot as-is (so every buffer has the same size, "Size")
+        static constexpr bool IsFixedSize = (IsWireTrivial_v<RemoveCvRef<ArgsT>> && ...);
+
+        // Size of the fixed-size part of the buffer (the slots of all args, including "Padding")
+        static constexpr std::size_t Size = Table.m_Size;
+
+        // Required alignment of the buffer (the largest alignment of any slot)
+        static constexpr std::size_t Alignment = Table.m_Alignment;
+
+        // Number of padding bytes in the fixed-size part of the buffer
+        static constexpr std::size_t Padding = Table.m_Padding;
+
+        // Offset of the slot of (zero-based) arg "i" from the start of the buffer
+        static constexpr std::size_t Offset(std::size_t i) noexcept
+        {
+            return Table.m_Offsets[i];
+        }
+
+        ///////////////////////////////////////////////////////////
+        // Returns the number of bytes "Serialize()" will write
+        // for the given args ("Size" itself if "IsFixedSize" is
+        // true, followed by what each "ArgMarshaller" writes
+        // otherwise)
+        ///////////////////////////////////////////////////////////
+        static std::size_t SerializedSize(const RemoveCvRef<ArgsT> &... args)
+        {
+            std::size_t size = Size;
+            ((size = AddMarshalledSize<RemoveCvRef<ArgsT>>(size, args)), ...);
+            return size;
+        }
+
+        ///////////////////////////////////////////////////////////
+        // Writes the given args to "buffer" (which must be at
+        // least "SerializedSize(args...)" bytes), each in a
+        // single "memcpy()" to its slot (or by its
+        // "ArgMarshaller" if it's not trivially copyable).
+        // Returns the number of bytes written. All padding bytes
+        // (at the end of the fixed-size part and before each
+        // "ArgMarshaller" payload) are zeroed, so no
+        // uninitialized memory ever leaks into the buffer.
+        // Throws "std::length_error" if an "ArgMarshaller"
+        // payload would end beyond 4 GiB (since "ArgExtent"
+        // only has 32 bit members).
+        ///////////////////////////////////////////////////////////
+        static std::size_t Serialize(void *buffer, const RemoveCvRef<ArgsT> &... args) noexcept(IsFixedSize)
+        {
+            return SerializeArgs(static_cast<std::byte *>(buffer), std::index_sequence_for<ArgsT...>(), args...);
+        }
 
-        //////////////////////////////////////////////////////////
-        // Create an instance of "Private::ForEachImpl" and
-        // invoke its "Process()" member function template,
-        // passing 0 for its template arg (to start processing
-        // the first iteration). The latter function then
-        // recursively invokes itself, calling "functor" "N"
-        // times or until "functor" returns false, whichever
-        // comes first (false only returned if "functor" wants to
-        // break like a normal "for" loop, which rarely happens
-        // in practice so we usually iterate "N" times)
-        //
-        // Note: The "ForEachFunctorT" template arg we're passing
-        // here as the 2nd template arg of class of
-        // "Private::ForEachImpl "means that the latter's
-        // constructor will take the same arg type as "functor"
-        // itself (& or && as usual). We then call "std::forward"
-        // as seen to pass "functor" to the constructor. Note
-        // that "std::forward" is mandatory here because
-        // "functor" is an lvalue even in the "&&" case (since
-        // it's named - named rvalue references are still
-        // lvalues). Attempting to pass "functor" directly would
-        // therefore cause a compiler error since you can't bind
-        // an lvalue (functor) to an rvalue reference (the arg
-        // type that the "Private::ForEachImpl" constructor is
-        // expecting in this case).
         ///////////////////////////////////////////////////////////
-        return Private::ForEachImpl<N, ForEachFunctorT>(std::forward<ForEachFunctorT>(functor)).template Process<0>();
-    #endif
-}
+        // Decoder to pass to "InvokeWithDecoder()" (see this for
+        // details) to invoke "F" with the args in a buffer
+        // written by "Serialize()". Args passed by value are
+        // copied from their slot (again, by a single
+        // "memcpy()"), and args passed by "const &" refer
+        // directly to their slot in the buffer (zero-copy),
+        // which must therefore be aligned on an "Alignment"
+        // boundary. Args that aren't trivially copyable are
+        // returned by their "ArgMarshaller::Read()". Note that
+        // args passed by non-"const" reference (lvalue or
+        // rvalue) of a trivially copyable type aren't supported.
+        ///////////////////////////////////////////////////////////
+        class Decoder
+        {
+        public:
+            explicit constexpr Decoder(const void *buffer) noexcept
+                : m_Buffer(static_cast<const std::byte *>(buffer))
+            {
+            }
 
-////////////////////////////////////////////////////////////////////////////
-// "IsForEachTupleFunctor" (primary template). Determines if template arg
-// "T" is a functor type whose "operator()" member has the following
-// signature and is also callable in the context of whether "T" is "const"
-// and/or "volatile" and or an lvalue or rvalue (read on):
+            template <std::size_t I,
+                      typename ArgTypeT>
+            decltype(auto) operator()() const
+            {
+                using T = RemoveCvRef<ArgTypeT>;
+                const std::byte *const slot = m_Buffer + Offset(I);
+
+                if constexpr (IsWireTrivial_v<T>)
+                {
+                    if constexpr (std::is_reference_v<ArgTypeT>)
+                    {
+                        static_assert(std::is_lvalue_reference_v<ArgTypeT> && std::is_const_v<std::remove_reference_t<ArgTypeT>>,
+                                      "Trivially copyable args passed by reference must be passed by \"const &\"");
+
+                        return *std::launder(reinterpret_cast<const T *>(slot));
+                    }
+                    else
+                    {
+                        alignas(T) std::byte value[sizeof(T)];
+                        std::memcpy(value, slot, sizeof(T));
+                        return T(*std::launder(reinterpret_cast<const T *>(value)));
+                    }
+                }
+                else
+                {
+                    static_assert(!std::is_lvalue_reference_v<ArgTypeT> || std::is_const_v<std::remove_reference_t<ArgTypeT>>,
+                                  "Args passed by non-\"const\" lvalue reference aren't supported");
+
+                    ArgExtent extent;
+                    std::memcpy(&extent, slot, sizeof(extent));
+                    return Marshaller_t<T>::Read(m_Buffer + extent.m_Offset, extent.m_Size);
+                }
+            }
+
+        private:
+            const std::byte *m_Buffer;
+        };
+
+    private:
+        template <typename T>
+        static std::size_t AddMarshalledSize(std::size_t size, const T &value)
+        {
+            if constexpr (IsWireTrivial_v<T>)
+            {
+                return size;
+            }
+            else
+            {
+                return AlignUp(size, alignof(T)) + Marshaller_t<T>::Size(value);
+            }
+        }
+
+        template <std::size_t I,
+                  typename T>
+        static void SerializeArg(std::byte *buffer, std::size_t &end, const T &value) noexcept(IsWireTrivial_v<T>)
+        {
+            if constexpr (IsWireTrivial_v<T>)
+            {
+                std::memcpy(buffer + Offset(I), std::addressof(value), sizeof(T));
+            }
+            else
+            {
+                const std::size_t start = AlignUp(end, alignof(T));
+                const std::size_t size = Marshaller_t<T>::Size(value);
+                if (size > UINT32_MAX || start > UINT32_MAX - size)
+                {
+                    throw std::length_error("\"ArgMarshaller\" payload doesn't fit in an \"ArgExtent\" (ends beyond 4 GiB)");
+                }
+
+                // Zero the alignment gap (if any) before the payload
+                std::memset(buffer + end, 0, start - end);
+                end = start;
+                Marshaller_t<T>::Write(value, buffer + end);
+
+                const ArgExtent extent = {static_cast<std::uint32_t>(end), static_cast<std::uint32_t>(size)};
+                std::memcpy(buffer + Offset(I), &extent, sizeof(extent));
+                end += size;
+            }
+        }
+
+        template <std::size_t... Is>
+        static std::size_t SerializeArgs([[maybe_unused]] std::byte *buffer,
+                                                          std::index_sequence<Is...>,
+                                                          const RemoveCvRef<ArgsT> &... args) noexcept(IsFixedSize)
+        {
+            // Padding only ever occurs at the end of the fixed-size part (see "MakeArgLayoutTable()")
+            if constexpr (Padding != 0)
+            {
+                std::memset(buffer + (Size - Padding), 0, Padding);
+            }
+
+            std::size_t end = Size;
+            (SerializeArg<Is>(buffer, end, args), ...);
+            return end;
+        }
+    };
+} // namespace Private
+STDEXT_END_PRIVATE
+
+/////////////////////////////////////////////////////////////////////////////
+// ArgLayout. Compile-time wire layout of the (non-variadic) args of "F"
+// (any function type "FunctionTraits" supports), used to serialize them
+// into a flat buffer (for passing to another process or node for
+// instance), and to invoke a function with the args in such a buffer
+// without any intermediate copies or allocations. Each arg is stored in a
+// slot in the fixed-size part of the buffer (of size "Size"), where the
+// slots are ordered by decreasing alignment so they're packed without any
+// padding between them (see "Private::MakeArgLayoutTable()"). Args that
+// are trivially copyable (other than pointers) are stored in their slot
+// as-is (so their native representation is used, meaning both ends must
+// share the same ABI), while all others are written by their
+// "ArgMarshaller" (a customization point you specialize for such types -
+// see this for details) following the fixed-size part, with their slot
+// recording where. The following members are available:
 //
-//     template <std::size_t I, typename TupleElementT>
-//     bool operator()() [const] [volatile] [&|&&];
+//     static constexpr std::size_t ArgCount;   // Number of (non-variadic) args in "F"
+//     static constexpr bool IsFixedSize;       // "true" if no "ArgMarshaller" is used by any arg
+//     static constexpr std::size_t Size;       // Size of the fixed-size part of the buffer
+//     static constexpr std::size_t Alignment;  // Required alignment of the buffer
+//     static constexpr std::size_t Padding;    // Padding bytes in the fixed-size part
+//     static constexpr std::size_t Offset(std::size_t i); // Offset of the slot of arg "i"
 //
-// If "T" contains this function AND it can also be called on an instance
-// of "T" (again, read on), then "T" qualifies as a functor that can be
-// passed to function template "ForEachTupleType()" declared later on. Note
-// that the specialization just below does the actual work of checking for
-// this. It simply invokes the above function template in an unevaluated
-// context using "std::declval()" as follows:
+//     static std::size_t SerializedSize(const ArgsT &... args);
+//     static std::size_t Serialize(void *buffer, const ArgsT &... args);
+//     class Decoder; // For passing to "InvokeWithDecoder()"
 //
-//     T::operator<0, void>()
+// where "ArgsT" are the arg types of "F" (after removing any reference
+// and cv-qualifiers). Note that the buffer passed to "Decoder" must be
+// aligned on an "Alignment" boundary, since args passed by "const &"
+// refer directly to their slot in the buffer (no copy is made).
 //
-// If the call succeeds then "operator()" must not only exist as a member
-// of "T" with a "bool" return type (we check for this as well), but it's
-// also callable in the context of whether "T" is "const" and/or "volatile"
-// and or an lvalue or rvalue. Note that to qualify as an lvalue for
-// purposes of "IsForEachTupleFunctor", "T" must be an lvalue reference
-// such as "int &". To qualify as an rvalue, "T" must either be a
-// non-reference type such as a plain "int" OR an rvalue reference such as
-// "int &&". The behaviour of what qualifies as an lvalue and rvalue for
-// purposes of using "IsForEachTupleFunctor" therefore follows the usual
-// perfect forwarding rules for function template arguments (where an
-// lvalue reference for "T" means the function's "T &&" argument collapses
-// to an lvalue reference, and a non-reference type or rvalue reference
-// type for "T" means the function's "T &&" argument is an rvalue reference
-// - read up on perfect forwarding for details if you're not already
-// familiar this).
+//     Example
+//     -------
+//     void OnOrder(std::uint64_t id, const Price &price, std::string_view symbol, int qty);
 //
-// As an example, if "T" contains the above "operator()" template but it's
-// not declared with the "const" qualifier but "T" itself is (declared
-// "const"), then calling the function as shown above fails since you can't
-// call a non-const member function using a constant object. The primary
-// template therefore kicks in, inheriting from "std::false_type".
-// Similarly, if "operator()" is declared with the "&&" reference qualifier
-// (rare as this is in practice), but "T" is an lvalue reference, then
-// again, the above call fails since you can't invoke a member function
-// declared with the "&&" (rvalue) reference qualifier using an lvalue
-// reference. Again, the primary template will therefore kick in (once
-// again inheriting from "std::false_type"). The upshot is that not only
-// must "operator()" exist as a member of "T", it must also be callable in
-// the context of "T" itself (whether "T" is "const" and/or "volatile"
-// and/or an lvalue reference, rvalue reference or non-reference - in all
-// cases "operator()" must be properly declared to support calls based on
-// the cv-qualifiers and/or lvalue/rvalue state of "T" itself as described
-// above). If it is then the specialization kicks in and
-// "IsForEachTupleFunctor" therefore inherits from "std::true_type"
-// (meaning "T" is a suitable functor type for passing as the 2nd template
-// arg of function template "ForEachTupleType()").
-////////////////////////////////////////////////////////////////////////////
-template <typename T, typename = void>
-struct IsForEachTupleFunctor : std::false_type
+//     using Layout = ArgLayout<decltype(OnOrder)>;
+//
+//     // Sender (where "buffer" is at least "Layout::SerializedSize(...)" bytes)
+//     const std::size_t size = Layout::Serialize(buffer, 42, price, "MSFT", 100);
+//
+//     // Receiver (where "received" is aligned on a "Layout::Alignment" boundary)
+//     InvokeWithDecoder(OnOrder, Layout::Decoder(received));
+/////////////////////////////////////////////////////////////////////////////
+template <TRAITS_FUNCTION_C F>
+class ArgLayout : public Private::ArgLayoutImpl<F>
 {
+    // See this constant for details
+    #if !CONCEPTS_SUPPORTED
+        /////////////////////////////////////////////////////
+        // Kicks in if concepts not supported, otherwise
+        // TRAITS_FUNCTION_C concept kicks in above instead
+        // (latter simply resolves to the "typename" keyword
+        // when concepts aren't supported)
+        /////////////////////////////////////////////////////
+        STATIC_ASSERT_IS_TRAITS_FUNCTION(F);
+    #endif
 };
 
-/////////////////////////////////////////////////////////////////
-// Specialization of "IsForEachTupleFunctor" (primary) template
-// just above. This specialization does all the work. See
-// primary template above for details. Note that calls to
-// "declval(T)" return "T &&" (unless "T" is void - see
-// "declval()" docs) so the following call to this works
-// according to the usual perfect forwarding rules in C++. That
-// is, if "T" is an lvalue reference then "declval()" returns an
-// lvalue reference (due to the C++ reference collapsing rules),
-// otherwise "T" must be an a non-reference or an rvalue
-// reference so "declval" returns an rvalue reference (in either
-// case). In all cases "declval()" therefore returns the same
-// function argument type used in a perfect forwarding function.
-// Such arguments are always of the type "T &&" which resolves
-// to an lvalue reference only if "T" is an lvalue reference
-// (again, due to the C++ reference collapsing rules), or an
-// rvalue reference if "T" is a non-reference or rvalue
-// reference. "declval()" therefore returns the exact same type
-// as a perfectly forwarded argument after plugging in "T" which
-// is what we require here (we're invoking "operator()" on that
-// argument in the following call in an unevaluated context
-// simply to make sure it can be invoked - the primary template
-// kicks in via SFINAE otherwise).
-/////////////////////////////////////////////////////////////////
-template <typename T>
-struct IsForEachTupleFunctor<T,
-                             // See explanation of "declval()" in comments above
-                             std::enable_if_t<std::is_same_v<decltype(std::declval<T>().template operator()<std::size_t(0), void>()), bool>>
+///////////////////////////////////////////////////////////////////////////
+// For internal use only (by the coroutine helpers just after this
+// namespace)
+///////////////////////////////////////////////////////////////////////////
+STDEXT_BEGIN_PRIVATE
+{
+    ///////////////////////////////////////////////////////////////////////
+    // HasAwaiterMembers. Inherits from "std::true_type" if "T" has
+    // "await_ready()" and "await_resume()" members (i.e., it's an
+    // "awaiter" in the C++20 sense, the object "co_await" actually
+    // operates on), or "std::false_type" otherwise. "await_suspend()"
+    // isn't checked since its arg is a "std::coroutine_handle" (of the
+    // awaiting coroutine's promise, which isn't known here).
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T,
+              typename = void>
+    struct HasAwaiterMembers : std::false_type
+    {
+    };
+
+    template <typename T>
+    struct HasAwaiterMembers<T,
+                             std::void_t<decltype(std::declval<std::add_lvalue_reference_t<T>>().await_ready()),
+                                         decltype(std::declval<std::add_lvalue_reference_t<T>>().await_resume())>
                             > : std::true_type
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////
+    // Awaiter_t. The awaiter that "co_await" operates on when applied to
+    // an (rvalue) "T", i.e., the result of "T::operator co_await()" or
+    // a free "operator co_await(T)" if either exists (C++20 or later
+    // only), or "T" itself otherwise (so "T" must then be an awaiter
+    // itself for "T" to qualify as awaitable - see "HasAwaiterMembers"
+    // above). Note that "await_transform()" in the awaiting coroutine's
+    // promise (if any) can't be taken into account since the awaiting
+    // coroutine isn't known here.
+    ///////////////////////////////////////////////////////////////////////
+    #if COROUTINES_SUPPORTED
+        template <typename T,
+                  typename = void>
+        struct FreeCoAwaitAwaiter
+        {
+            using Type = T;
+        };
+
+        template <typename T>
+        struct FreeCoAwaitAwaiter<T,
+                                  std::void_t<decltype(operator co_await(std::declval<T>()))>
+                                 >
+        {
+            using Type = decltype(operator co_await(std::declval<T>()));
+        };
+
+        template <typename T,
+                  typename = void>
+        struct MemberCoAwaitAwaiter : FreeCoAwaitAwaiter<T>
+        {
+        };
+
+        template <typename T>
+        struct MemberCoAwaitAwaiter<T,
+                                    std::void_t<decltype(std::declval<T>().operator co_await())>
+                                   >
+        {
+            using Type = decltype(std::declval<T>().operator co_await());
+        };
+
+        template <typename T>
+        using Awaiter_t = typename MemberCoAwaitAwaiter<T>::Type;
+    #else
+        template <typename T>
+        using Awaiter_t = T;
+    #endif
+
+    ///////////////////////////////////////////////////////////////////////
+    // HasPromiseType. Inherits from "std::true_type" if "T" has a
+    // nested "promise_type" (so it can be the return type of a
+    // coroutine, absent any "std::coroutine_traits" specialization of
+    // your own), or "std::false_type" otherwise. "NothrowConstructible"
+    // is "true" if "promise_type" also has a "noexcept" default
+    // constructor (or "false" if it doesn't or "T" has no
+    // "promise_type").
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T,
+              typename = void>
+    struct HasPromiseType : std::false_type
+    {
+        static constexpr bool NothrowConstructible = false;
+    };
+
+    template <typename T>
+    struct HasPromiseType<T,
+                          std::void_t<typename T::promise_type>
+                         > : std::true_type
+    {
+        static constexpr bool NothrowConstructible = std::is_nothrow_default_constructible_v<typename T::promise_type>;
+    };
+
+    ///////////////////////////////////////////////////////////////////////
+    // AwaitResumeType. "Type" is the type "co_await" yields for an
+    // rvalue "T" (the return type of its awaiter's "await_resume()") if
+    // "IsAwaitableT" is true, or "T" itself otherwise
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T,
+              bool IsAwaitableT>
+    struct AwaitResumeType
+    {
+        using Type = T;
+    };
+
+    template <typename T>
+    struct AwaitResumeType<T, true>
+    {
+        using Type = decltype(std::declval<std::add_lvalue_reference_t<Awaiter_t<T>>>().await_resume());
+    };
+} // namespace Private
+STDEXT_END_PRIVATE
+
+/////////////////////////////////////////////////////////////////////////////
+// IsReturnTypeAwaitable_v. "bool" variable set to "true" if the return
+// type of "F" is awaitable, i.e., "co_await" can be applied to it (the
+// value "F" returns), or "false" otherwise. A type is considered
+// awaitable if it's an awaiter itself (it has "await_ready()" and
+// "await_resume()" members), or (C++20 or later) it has a member or free
+// "operator co_await" returning one. Note that this is normally the case
+// for the "task" (or similar) types returned by asynchronous
+// coroutines, but not for synchronous "generator" types (see
+// "IsReturnTypeCoroutine_v" for these).
+/////////////////////////////////////////////////////////////////////////////
+template <TRAITS_FUNCTION_C F>
+inline constexpr bool IsReturnTypeAwaitable_v = Private::HasAwaiterMembers<Private::Awaiter_t<ReturnType_t<F>>>::value;
+
+/////////////////////////////////////////////////////////////////////////////
+// IsReturnTypeCoroutine_v. "bool" variable set to "true" if the return
+// type of "F" has a nested "promise_type", i.e., it's a coroutine return
+// type such as a "task" or "generator" (so "F" is normally a coroutine
+// itself), or "false" otherwise. Note that return types that rely on a
+// "std::coroutine_traits" specialization instead of a nested
+// "promise_type" can't be detected (since the specialization can depend
+// on the function's arg types as well as the return type).
+/////////////////////////////////////////////////////////////////////////////
+template <TRAITS_FUNCTION_C F>
+inline constexpr bool IsReturnTypeCoroutine_v = Private::HasPromiseType<ReturnType_t<F>>::value;
+
+/////////////////////////////////////////////////////////////////////////////
+// AwaitResumeType_t. Type alias for what the return value of "F"
+// ultimately yields, i.e., the type of "co_await f(...)" (the return type
+// of its awaiter's "await_resume()") if "IsReturnTypeAwaitable_v<F>" is
+// "true", or the return type of "F" itself otherwise (since its return
+// value is available as soon as "F" returns). For a function returning
+// "task<int>" for instance (where "task" is a typical awaitable coroutine
+// return type) it's therefore "int".
+/////////////////////////////////////////////////////////////////////////////
+template <TRAITS_FUNCTION_C F>
+using AwaitResumeType_t = typename Private::AwaitResumeType<ReturnType_t<F>, IsReturnTypeAwaitable_v<F>>::Type;
+
+/////////////////////////////////////////////////////////////////////////////
+// IsPromiseNothrowConstructible_v. "bool" variable set to "true" if the
+// return type of "F" has a nested "promise_type" (see
+// "IsReturnTypeCoroutine_v") with a "noexcept" default constructor (so
+// starting the coroutine can't throw before its body is entered other
+// than by allocating its frame), or "false" otherwise.
+/////////////////////////////////////////////////////////////////////////////
+template <TRAITS_FUNCTION_C F>
+inline constexpr bool IsPromiseNothrowConstructible_v = Private::HasPromiseType<ReturnType_t<F>>::NothrowConstructible;
+
+/////////////////////////////////////////////////////////////////////////////
+// IsSuspending_v. "bool" variable set to "true" if "F" (normally) suspends,
+// i.e., its return type is awaitable or a coroutine return type (see
+// "IsReturnTypeAwaitable_v" and "IsReturnTypeCoroutine_v"), or "false"
+// otherwise (so calling "F" always runs it to completion). Used by
+// "InvokeAsync()" (see this for details).
+/////////////////////////////////////////////////////////////////////////////
+template <TRAITS_FUNCTION_C F>
+inline constexpr bool IsSuspending_v = IsReturnTypeAwaitable_v<F> || IsReturnTypeCoroutine_v<F>;
+
+/////////////////////////////////////////////////////////////////////////////
+// InvokeAsync(). Invokes "function" (a free function, pointer or reference
+// to a free function, or a functor) with the given args, either inline or
+// by way of "post" depending on whether "function" suspends (as determined
+// at compile time by "IsSuspending_v"). If it doesn't (its return type
+// isn't awaitable or a coroutine return type) then it's simply invoked
+// inline (on the calling thread), returning whatever "function" returns,
+// so no scheduling hop ever occurs for it. Otherwise "post" is invoked
+// instead, passing it a functor taking no args that invokes "function"
+// (which "post" normally hands off to a worker thread or the like),
+// returning whatever "post" returns. The functor owns (moved or copied)
+// copies of "function" and the args so they need not outlive the call
+// (the args are passed to "function" as rvalues when the functor is
+// invoked, so they can't be passed by non-"const" lvalue reference in
+// this case).
+//
+//     Example
+//     -------
+//     int Parse(const Message &);         // Runs inline (never suspends)
+//     task<int> Fetch(const Message &);   // Posted to the pool (suspends)
+//
+//     auto post = [&pool](auto &&work) { return pool.Submit(std::move(work)); };
+//
+//     InvokeAsync(post, Parse, message); // Calls "Parse(message)" directly
+//     InvokeAsync(post, Fetch, message); // Calls "pool.Submit()"
+/////////////////////////////////////////////////////////////////////////////
+template <typename PostT,
+          typename F,
+          typename... ArgsT>
+inline decltype(auto) InvokeAsync(PostT &&post, F &&function, ArgsT &&... args)
+{
+    using FunctionT = RemoveCvRef<F>;
+
+    // See this constant for details
+    #if !CONCEPTS_SUPPORTED
+        /////////////////////////////////////////////////////
+        // Kicks in if concepts not supported (always true
+        // below if they are since "IsSuspending_v" is
+        // constrained by the TRAITS_FUNCTION_C concept)
+        /////////////////////////////////////////////////////
+        STATIC_ASSERT_IS_TRAITS_FUNCTION(FunctionT);
+    #endif
+
+    static_assert(IsFreeFunction_v<FunctionT> || IsFunctor_v<FunctionT>,
+                  "\"function\" must be a free function or functor");
+
+    if constexpr (!IsSuspending_v<FunctionT>)
+    {
+        return std::forward<F>(function)(std::forward<ArgsT>(args)...);
+    }
+    else
+    {
+        return std::forward<PostT>(post)([function = std::forward<F>(function),
+                                          argsTuple = std::tuple<std::decay_t<ArgsT>...>(std::forward<ArgsT>(args)...)]() mutable -> decltype(auto)
+                                         {
+                                             return std::apply(function, std::move(argsTuple));
+                                         });
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+// For internal use only (by "FunctionRef" and "Delegate" just after this
+// namespace)
+///////////////////////////////////////////////////////////////////////////
+STDEXT_BEGIN_PRIVATE
 {
-};
+    ///////////////////////////////////////////////////////////////////////
+    // IsFunctionPointerOrRef_v. "true" if "T" is a (raw) free function
+    // type, a pointer to one or a reference to either, or "false"
+    // otherwise. Used by "FunctionRef" to distinguish targets that are
+    // stored as a function pointer from those stored by address.
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T>
+    inline constexpr bool IsFunctionPointerOrRef_v = std::is_function_v<RemovePtrRef<T>> &&
+                                                     (std::is_function_v<std::remove_reference_t<T>> ||
+                                                      std::is_pointer_v<std::remove_reference_t<T>>);
 
-/////////////////////////////////////////////////////////
-// Helper variable template for "IsForEachTupleFunctor"
-// just above (with the usual "_v" suffix).
-/////////////////////////////////////////////////////////
-template <typename T>
-inline constexpr bool IsForEachTupleFunctor_v = IsForEachTupleFunctor<T>::value;
+    ///////////////////////////////////////////////////////////////////////
+    // FunctionRefImpl (primary template). Implements "FunctionRef"
+    // declared just after this namespace (which just derives from the
+    // partial specialization below). The primary template is never
+    // used, only the partial specialization just below is, which
+    // "FunctionRef" specializes on "ArgTypeList_t<F>" so that the
+    // function's argument types are available as a parameter pack.
+    ///////////////////////////////////////////////////////////////////////
+    template <typename F,
+              typename ArgTypeListT = ArgTypeList_t<F>>
+    class FunctionRefImpl;
 
-//////////////////////////////////////////////
-// Concept for above template (see following
-// #defined constant for details)
-//////////////////////////////////////////////
-#if CONCEPTS_SUPPORTED
-    template <typename T>
-    concept ForEachTupleFunctor_c = IsForEachTupleFunctor_v<T>;
+    template <typename F,
+              typename... ArgsT>
+    class FunctionRefImpl<F, TypeList<ArgsT...>>
+    {
+    public:
+        using ReturnType = ReturnType_t<F>;
+        static constexpr bool IsNoexcept = IsNoexcept_v<F>;
 
-    #define FOR_EACH_TUPLE_FUNCTOR_C StdExt::ForEachTupleFunctor_c
-#else
-    #define STATIC_ASSERT_IS_FOR_EACH_TUPLE_FUNCTOR(T) static_assert(StdExt::IsForEachTupleFunctor_v<T>);
+        ///////////////////////////////////////////////////////////
+        // Constructor taking the target to invoke, either a free
+        // function (or pointer or reference to one), or a functor
+        // (or reference to one) which must outlive this object
+        // (it's stored by address only, never copied). Note that
+        // the target's own type (including its calling
+        // convention) is preserved, since it's always invoked
+        // through its exact type by "Invoke()" below (so a
+        // "__vectorcall" function for instance is still called
+        // using "__vectorcall").
+        ///////////////////////////////////////////////////////////
+        template <typename T,
+                  typename = std::enable_if_t<!std::is_base_of_v<FunctionRefImpl, RemoveCvRef<T>>>>
+        FunctionRefImpl(T &&target) noexcept
+            : m_Invoker(&Invoke<T>)
+        {
+            static_assert(IsNoexcept ? std::is_nothrow_invocable_r_v<ReturnType, T &, ArgsT...>
+                                     : std::is_invocable_r_v<ReturnType, T &, ArgsT...>,
+                          "\"target\" must be invocable with the arguments of \"F\" (and it must be "
+                          "\"noexcept\" if \"F\" is)");
 
-    #define FOR_EACH_TUPLE_FUNCTOR_C typename
-#endif
+            if constexpr (IsFunctionPointerOrRef_v<T>)
+            {
+                m_Target.m_Function = reinterpret_cast<void (*)()>(FunctionPointerOf(target));
+            }
+            else
+            {
+                m_Target.m_Object = const_cast<void *>(static_cast<const volatile void *>(std::addressof(target)));
+            }
+        }
 
-///////////////////////////////////////////////////////////////////////////
-// For C++17 only we'll rely on the "ProcessTupleType" functor declared
-// just below (used exclusively by function template "ForEachTupleType()"
-// declared just after). For C++20 and later we'll rely on a lambda
-// template instead (the equivalent of the struct just below but locally
-// declared in function template "ForEachTupleType()" so it's cleaner).
-// Note that lambda templates aren't supported until C++20. Lastly, note
-// that we're currently inside a "#if CPP17_OR_LATER" preprocessor block
-// (we're processing code for C++17 or later) so if the #defined constant
-// CPP17_OR_EARLIER we're testing just below is false (0), then we're
-// guaranteed to be processing C++20 or later (again, because we know that
-// the #defined constant CPP17_OR_LATER is currently true).
-// /////////////////////////////////////////////////////////////////////////
-#if CPP17_OR_EARLIER
-    ///////////////////////////////////////////////////
-    // For internal use only (by "ForEachTupleType()"
-    // just after this namespace)
-    ///////////////////////////////////////////////////
-    namespace Private
-    {
-        /////////////////////////////////////////////////////////////
-        // class ProcessTupleType. Private implementation class
-        // used by function template "ForEachTupleType()" declared
-        // just after this private namespace. See this for
-        // details.  Note that in the following class,
-        // "ForEachTupleFunctorT" is always the same template type
-        // passed to "ForEachTupleType()", so either "T &" for the
-        // lvalue case or just plain "T" or "T &&" for the rvalue
-        // case (for the "rvalue" case however usually just plain
-        // "T" as per the usual perfect forwarding rules when
-        // invoking such functions via implicit type deduction).
+        ReturnType operator()(ArgsT... args) const noexcept(IsNoexcept)
+        {
+            return m_Invoker(m_Target, std::forward<ArgsT>(args)...);
+        }
+
+    private:
         ///////////////////////////////////////////////////////////
-        template <typename TupleT, typename ForEachTupleFunctorT>
-        class ProcessTupleType
+        // The target itself, either a function pointer (stored
+        // as a generic function pointer and cast back to its
+        // original type before being called, which C++
+        // guarantees yields the original pointer), or the
+        // address of a functor (cast back to its original type
+        // in the same way)
+        ///////////////////////////////////////////////////////////
+        union Target
         {
-            STATIC_ASSERT_IS_TUPLE(TupleT);
-            STATIC_ASSERT_IS_FOR_EACH_TUPLE_FUNCTOR(ForEachTupleFunctorT);
+            void *m_Object;
+            void (*m_Function)();
+        };
 
-        public:
-            /////////////////////////////////////////////////////////
-            // Constructor. Note that we always pass "functor" by a
-            // "std::forward" reference so "functor" resolves to "&"
-            // or "&&" accordingly
-            /////////////////////////////////////////////////////////
-            constexpr ProcessTupleType(ForEachTupleFunctorT &&functor) noexcept
-                ///////////////////////////////////////////////////////////
-                // "std::forward" required when "ForEachTupleFunctorT" is
-                // "&&". Both "functor" and "m_Functor" are therefore "&&"
-                // but "functor" is still an lvalue because it's named
-                // (rvalue references that are named are lvalues!).
-                // Therefore illegal to bind an lvalue (functor) to an
-                // rvalue reference (m_Functor) so "std::forward" is
-                // required to circumvent this (for the "&&" case it
-                // returns an "&&" reference but it's now unnamed so an
-                // rvalue and therefore suitable for initializing
-                // "m_Functor")
-                ///////////////////////////////////////////////////////////
-                : m_Functor(std::forward<ForEachTupleFunctorT>(functor))
+        template <typename T>
+        static auto FunctionPointerOf(T &&target) noexcept
+        {
+            return static_cast<std::add_pointer_t<RemovePtrRef<T>>>(target);
+        }
+
+        template <typename T>
+        static ReturnType Invoke(Target target, ArgsT... args) noexcept(IsNoexcept)
+        {
+            if constexpr (IsFunctionPointerOrRef_v<T>)
             {
+                return reinterpret_cast<std::add_pointer_t<RemovePtrRef<T>>>(target.m_Function)(std::forward<ArgsT>(args)...);
             }
+            else
+            {
+                return (*static_cast<std::remove_reference_t<T> *>(target.m_Object))(std::forward<ArgsT>(args)...);
+            }
+        }
 
-            template <std::size_t I>
-            constexpr bool operator()() const
+        using Invoker = ReturnType (*)(Target, ArgsT...) noexcept(IsNoexcept);
+
+        Invoker m_Invoker;
+        Target m_Target;
+    };
+
+    ///////////////////////////////////////////////////////////////////////
+    // DelegateImpl (primary template). Implements "Delegate" declared
+    // just after this namespace. Same idea as "FunctionRefImpl" above
+    // (see this for details) but the target is copied into
+    // (owned by) the object's own internal buffer (of "BufferSize"
+    // bytes) instead.
+    ///////////////////////////////////////////////////////////////////////
+    template <typename F,
+              std::size_t BufferSize,
+              typename ArgTypeListT = ArgTypeList_t<F>>
+    class DelegateImpl;
+
+    template <typename F,
+              std::size_t BufferSize,
+              typename... ArgsT>
+    class DelegateImpl<F, BufferSize, TypeList<ArgsT...>>
+    {
+    public:
+        using ReturnType = ReturnType_t<F>;
+        static constexpr bool IsNoexcept = IsNoexcept_v<F>;
+
+        // Empty delegate (invoking it is undefined behavior)
+        constexpr DelegateImpl() noexcept = default;
+
+        ////////////////////////////////////////////////////////////
+        // Constructor taking the target to invoke, either a free
+        // function (or pointer or reference to one), or a functor.
+        // The target is (decay) copied or moved into the internal
+        // buffer so it must fit in "BufferSize" bytes (and its
+        // alignment can't exceed "std::max_align_t"). Note that
+        // no memory is ever allocated (a "static_assert" occurs
+        // instead if the target doesn't fit).
+        ////////////////////////////////////////////////////////////
+        template <typename T,
+                  typename = std::enable_if_t<!std::is_base_of_v<DelegateImpl, RemoveCvRef<T>>>>
+        DelegateImpl(T &&target) noexcept(std::is_nothrow_constructible_v<std::decay_t<T>, T>)
+        {
+            using TargetT = std::decay_t<T>;
+
+            static_assert(sizeof(TargetT) <= BufferSize && alignof(TargetT) <= alignof(std::max_align_t),
+                          "\"target\" doesn't fit in the delegate's buffer (increase template arg \"BufferSize\")");
+            static_assert(std::is_copy_constructible_v<TargetT> && std::is_nothrow_move_constructible_v<TargetT>,
+                          "\"target\" must be copy constructible and nothrow move constructible");
+            static_assert(IsNoexcept ? std::is_nothrow_invocable_r_v<ReturnType, TargetT &, ArgsT...>
+                                     : std::is_invocable_r_v<ReturnType, TargetT &, ArgsT...>,
+                          "\"target\" must be invocable with the arguments of \"F\" (and it must be "
+                          "\"noexcept\" if \"F\" is)");
+
+            ::new (static_cast<void *>(m_Buffer)) TargetT(std::forward<T>(target));
+            m_Invoker = &Invoke<TargetT>;
+            m_Manager = &Manage<TargetT>;
+        }
+
+        DelegateImpl(const DelegateImpl &other)
+            : m_Invoker(other.m_Invoker),
+              m_Manager(other.m_Manager)
+        {
+            if (m_Manager)
             {
-                using TupleElement_t = std::tuple_element_t<I, TupleT>;
+                m_Manager(Operation::Copy, m_Buffer, const_cast<unsigned char *>(other.m_Buffer));
+            }
+        }
 
-                //////////////////////////////////////////////////////////
-                // Note: Call to "std::forward()" here required to:
-                // 
-                //    1) Perfect forward "m_Functor" back to "&" or "&&"
-                //       accordingly
-                //    2) In the "&&" case, invoke "operator()" in the
-                //       context of an rvalue (in particular, can't do
-                //       this on "m_Functor" directly, without invoking
-                //       "std::forward", since "m_Functor" is an lvalue
-                //       so the lvalue version of "operator()" would kick
-                //       in in the following call instead!!)
-                //////////////////////////////////////////////////////////
-                return std::forward<ForEachTupleFunctorT>(m_Functor).template operator()<I, TupleElement_t>();
+        DelegateImpl(DelegateImpl &&other) noexcept
+            : m_Invoker(other.m_Invoker),
+              m_Manager(other.m_Manager)
+        {
+            if (m_Manager)
+            {
+                m_Manager(Operation::Move, m_Buffer, other.m_Buffer);
+                other.m_Invoker = nullptr;
+                other.m_Manager = nullptr;
             }
+        }
 
-        private:
-            /////////////////////////////////////////////////////
-            // Note: Resolves to "&" in the lvalue case or "&&"
-            // otherwise (by the usual C++ reference collapsing
-            // rules - "ForEachTupleFunctorT" is always "T &"
-            // in the former case or either plain "T" or "T &&"
-            // otherwise)
-            /////////////////////////////////////////////////////
-            ForEachTupleFunctorT &&m_Functor;
+        DelegateImpl &operator=(const DelegateImpl &other)
+        {
+            if (this != &other)
+            {
+                DelegateImpl copy(other);
+                *this = std::move(copy);
+            }
+
+            return *this;
+        }
+
+        DelegateImpl &operator=(DelegateImpl &&other) noexcept
+        {
+            if (this != &other)
+            {
+                Reset();
+
+                if (other.m_Manager)
+                {
+                    other.m_Manager(Operation::Move, m_Buffer, other.m_Buffer);
+                }
+
+                m_Invoker = other.m_Invoker;
+                m_Manager = other.m_Manager;
+                other.m_Invoker = nullptr;
+                other.m_Manager = nullptr;
+            }
+
+            return *this;
+        }
+
+        ~DelegateImpl()
+        {
+            Reset();
+        }
+
+        // "true" if a target is stored or "false" otherwise
+        constexpr explicit operator bool() const noexcept
+        {
+            return m_Invoker != nullptr;
+        }
+
+        /////////////////////////////////////////////////////////
+        // Invokes the target (as a non-const lvalue, just like
+        // "std::function"). It's undefined behavior to invoke
+        // an empty delegate (check "operator bool" above if
+        // required).
+        /////////////////////////////////////////////////////////
+        ReturnType operator()(ArgsT... args) const noexcept(IsNoexcept)
+        {
+            return m_Invoker(const_cast<unsigned char *>(m_Buffer), std::forward<ArgsT>(args)...);
+        }
+
+    private:
+        enum class Operation
+        {
+            Copy,
+            Move,
+            Destroy
         };
-    } // namespace Private
-#endif
 
-/////////////////////////////////////////////////////////////////////////
-// ForEachTupleType(). Iterates all tuple elements in "TupleT" where
-// "TupleT" is a "std::tuple" specialization, and invokes the given
-// "functor" for each. The effect of this function is that all types in
-// "TupleT" are iterated or none if "TupleT" is empty. For each type in
-// "TupleT", the given "functor" is invoked as noted. "functor" must be
-// a functor with the following functor (template) signature (where
-// items in square brackets are optional - note that an invalid functor
-// will trigger the FOR_EACH_TUPLE_FUNCTOR_C concept in C++20 or later,
-// or a "static_assert" in C++17, since we don't support earlier
-// versions - compile fails either way)
-//
-//     template <std::size_t I, typename TupleElementT>
-//     bool operator()() [const] [volatile] [ref-qualifier] [noexcept];
-//
-// Note that lambdas with this signature are also (therefore) supported
-// in C++20 or later (since lambda templates aren't supported in earlier
-// versions of C++ so you'll have to roll your own functor template if
-// targeting C++17). Note that free functions or other non-static member
-// functions besides "operator()" are not currently supported (but may
-// be in a future release):
-//
-//     Example
-//     -------
-//     ////////////////////////////////////////////////////////
-//     // Some tuple whose types you wish to iterate (display
-//     // in this example - see "displayTupleType" lambda
-//     // below).
-//     ////////////////////////////////////////////////////////
-//     std::tuple<int, float, double> someTuple;
-//
-//     /////////////////////////////////////////////////////////////////
-//     // Lambda that will be invoked just below, once for each type in
-//     // "someTuple()" above (where template arg "I" is the zero-based
-//     // "Ith" index of the type in "someTuple", and "TupleElementT" is
-//     // its type). Note that lambda templates are supported in C++20
-//     // and later only. For C++17 (this header doesn't support earlier
-//     // versions), you need to roll your own functor instead (with a
-//     // template version of "operator()" equivalent to this lambda)
-//     /////////////////////////////////////////////////////////////////
-//     const auto displayTupleType = []<std::size_t I, typename TupleElementT>()
-//                                   {
-//                                       /////////////////////////////////////////////////////////
-//                                       // Display the type of the (zero-based) "Ith" type in
-//                                       // "someTuple" using the following format (shown here
-//                                       // for "I" equals zero so "TupleElementT" is therefore
-//                                       // an "int", but whatever "I" and "TupleElementT" are
-//                                       // on each iteration - note that we increment zero-based
-//                                       // "I" by 1 however to display it as 1-based since it's
-//                                       // more natural for display purposes):
-//                                       //
-//                                       //    1) int
-//                                       //
-//                                       // Note that we never come through here if the tuple
-//                                       // represented by "someTuple" is empty.
-//                                       /////////////////////////////////////////////////////////
-//                                       tcout << (I + 1) << _T(") ") << TypeName_v<TupleElementT> << _T("\n");
+        template <typename TargetT>
+        static ReturnType Invoke(void *buffer, ArgsT... args) noexcept(IsNoexcept)
+        {
+            return (*std::launder(static_cast<TargetT *>(buffer)))(std::forward<ArgsT>(args)...);
+        }
+
+        ////////////////////////////////////////////////////////////
+        // Copies, moves or destroys the target of type "TargetT".
+        // For "Copy" and "Move", "dest" is the (uninitialized)
+        // buffer to construct the target in and "source" the
+        // buffer storing the target to copy or move (the latter
+        // is destroyed after it's moved). For "Destroy" the
+        // target in "dest" is destroyed ("source" is ignored).
+        ////////////////////////////////////////////////////////////
+        template <typename TargetT>
+        static void Manage(Operation operation, void *dest, void *source)
+        {
+            switch (operation)
+            {
+                case Operation::Copy:
+                    ::new (dest) TargetT(*std::launder(static_cast<const TargetT *>(source)));
+                    break;
+                case Operation::Move:
+                    ::new (dest) TargetT(std::move(*std::launder(static_cast<TargetT *>(source))));
+                    std::launder(static_cast<TargetT *>(source))->~TargetT();
+                    break;
+                case Operation::Destroy:
+                    std::launder(static_cast<TargetT *>(dest))->~TargetT();
+                    break;
+            }
+        }
+
+        void Reset() noexcept
+        {
+            if (m_Manager)
+            {
+                m_Manager(Operation::Destroy, m_Buffer, nullptr);
+                m_Invoker = nullptr;
+                m_Manager = nullptr;
+            }
+        }
+
+        using Invoker = ReturnType (*)(void *, ArgsT...) noexcept(IsNoexcept);
+        using Manager = void (*)(Operation, void *, void *);
+
+        Invoker m_Invoker = nullptr;
+        Manager m_Manager = nullptr;
+        alignas(std::max_align_t) unsigned char m_Buffer[BufferSize] = {}; // Value-initialized so the default constructor is "constexpr"
+    };
+} // namespace Private
+STDEXT_END_PRIVATE
+
+/////////////////////////////////////////////////////////////////////////////
+// FunctionRef. Non-owning (type-erased) reference to any callable target
+// whose signature is compatible with function "F", a lightweight
+// alternative to "std::function" that never allocates memory (it just
+// stores a pointer to the target and a pointer to a small function that
+// invokes it). The return type, argument types and "noexcept" specifier
+// of "operator()" are all taken from "FunctionTraits<F>" (i.e.,
+// "ReturnType_t<F>", "ArgTypeList_t<F>" and "IsNoexcept_v<F>"), so "F" is
+// simply the signature of the function you wish to invoke, normally a
+// free function type (or pointer or reference to one). The target can
+// be any free function (or pointer or reference to one) or functor
+// (including lambdas) that's invocable with these arguments. Functor
+// targets are stored by address so they must outlive the "FunctionRef"
+// that refers to them (normally "FunctionRef" is used as a function
+// parameter, in which case the target is usually a temporary that lives
+// until the function returns). Invoking a "FunctionRef" always costs
+// exactly one indirect call, to an internal thunk that then invokes the
+// target through its exact type (so functor targets are normally inlined
+// into it, and function pointer targets are called using their own
+// calling convention, whatever it is). Note that the call is therefore
+// never thunk-free. The thunk itself always has the default calling
+// convention (C++ can't declare a function whose calling convention comes
+// from a template arg), so for a function pointer target (such as a
+// "__vectorcall" function) it costs a 2nd call, from the thunk to the
+// target, using the target's own calling convention.
 //
-//                                       //////////////////////////////////////////////
-//                                       // Return true to continue iterating (false
-//                                       // would stop iterating, equivalent to a
-//                                       // "break" statement in a regular "for" loop)
-//                                       //////////////////////////////////////////////
-//                                       return true;
-//                                   };
+//     Example
+//     -------
+//     void ForEachItem(FunctionRef<void (int)> callback);
 //
-//     ///////////////////////////////////////////////////////////////
-//     // Iterate all tuple elements in "someTuple" meaning once for
-//     // each type in "someTuple()" above. Invokes "displayTupleType"
-//     // above for each. Outputs the following:
-//     //
-//     //     1) int
-//     //     2) float
-//     //     3) double
-//     //
-//     // Note that "ForEachTupleType()" returns true if the functor
-//     // you pass ("displayTupleType" in this example) returns true
-//     // or false otherwise (useful if your functor needs to "break"
-//     // like a normal "for" loop for any reason - iteration
-//     // immediately stops if it returns false and the following
-//     // therefore returns false). Always returns true in the above
-//     // example (and typically in most real-world code as well)
-//     ///////////////////////////////////////////////////////////////
-//     ForEachTupleType<decltype(someTuple)>(displayTupleType);
-/////////////////////////////////////////////////////////////////////////
-template <TUPLE_C TupleT, FOR_EACH_TUPLE_FUNCTOR_C ForEachTupleFunctorT>
-inline constexpr bool ForEachTupleType(ForEachTupleFunctorT&& functor)
+//     int total = 0;
+//     ForEachItem([&total](int item) { total += item; });
+/////////////////////////////////////////////////////////////////////////////
+template <TRAITS_FUNCTION_C F>
+class FunctionRef : public Private::FunctionRefImpl<F>
 {
     // See this constant for details
     #if !CONCEPTS_SUPPORTED
-        //////////////////////////////////////////////////
+        /////////////////////////////////////////////////////
         // Kicks in if concepts not supported, otherwise
-        // TUPLE_C concept kicks in above instead (latter
-        // simply resolves to the "typename" keyword when
-        // conppets not supported)
-        //////////////////////////////////////////////////
-        STATIC_ASSERT_IS_TUPLE(TupleT)
+        // TRAITS_FUNCTION_C concept kicks in above instead
+        // (latter simply resolves to the "typename" keyword
+        // when concepts aren't supported)
+        /////////////////////////////////////////////////////
+        STATIC_ASSERT_IS_TRAITS_FUNCTION(F);
+    #endif
 
-        ///////////////////////////////////////////////
-        // Kicks in if C++ 17 or earlier, otherwise
-        // FOR_EACH_TUPLE_FUNCTOR_C concept kicks in
-        // above instead (latter simply resolves to
-        // the "typename" keyword in C++17 or earlier)
-        ///////////////////////////////////////////////
-        STATIC_ASSERT_IS_FOR_EACH_TUPLE_FUNCTOR(ForEachTupleFunctorT)
+    static_assert(IsFreeFunction_v<F>, "\"F\" must be a free function signature (or pointer or reference to one)");
+
+public:
+    using Private::FunctionRefImpl<F>::FunctionRefImpl;
+};
+
+/////////////////////////////////////////////////////////////////////////////
+// Delegate. Owning version of "FunctionRef" just above. Same as the latter
+// except the target is copied into the delegate's own internal buffer of
+// "BufferSize" bytes (four pointers by default, enough for most lambdas
+// and all function pointers) so it need not outlive the delegate. No memory
+// is ever allocated (targets that don't fit in the buffer are rejected by a
+// "static_assert" instead of falling back to the heap like "std::function"
+// normally does). Invoking a "Delegate" costs exactly one indirect call to
+// an internal thunk as for "FunctionRef" (see this for details, including
+// the 2nd call the thunk makes to function pointer targets). Note that
+// targets must be copy constructible (like "std::function") and nothrow
+// move constructible. A default constructed (empty) "Delegate" can be
+// constant initialized (e.g., "constinit" in C++20).
+/////////////////////////////////////////////////////////////////////////////
+template <TRAITS_FUNCTION_C F,
+          std::size_t BufferSize = 4 * sizeof(void *)>
+class Delegate : public Private::DelegateImpl<F, BufferSize>
+{
+    // See this constant for details
+    #if !CONCEPTS_SUPPORTED
+        /////////////////////////////////////////////////////
+        // Kicks in if concepts not supported, otherwise
+        // TRAITS_FUNCTION_C concept kicks in above instead
+        // (latter simply resolves to the "typename" keyword
+        // when concepts aren't supported)
+        /////////////////////////////////////////////////////
+        STATIC_ASSERT_IS_TRAITS_FUNCTION(F);
     #endif
 
-    /////////////////////////////////////////////////////////////////
-    // IMPORTANT
-    // ---------
-    // (Note: You need not read this (very) long explanation since
-    // we've correctly worked around it as described below, but I've
-    // included it here for posterity).
-    //
-    // The following call checks for zero as seen (true only when
-    // "TupleT" is empty), in order to completely bypass the call to
-    // "ForEach()" seen further below (when "TupleT" isn't empty).
-    // There's no need to call "ForEach()" further below if the
-    // tuple is empty since there's nothing to iterate. Note however
-    // that the latter call to "ForEach()" itself will also handle
-    // an empty tuple, since it will immediately return true if its
-    // "N" template arg is zero (0). The following check for an
-    // empty tuple would therefore seem to be redundant
-    // (unnecessary), since "ForEach()" also correctly deals with
-    // the situation. However, there's a subtle issue at play here
-    // that requires us not to call "ForEach()" when the tuple is in
-    // fact empty. Doing so would mean that the "operator()"
-    // template member of the "processTupleType" functor we're
-    // passing to "ForEach" below will be specialized on zero, (its
-    // "std::size_t" template arg will be zero), even though it will
-    // never actually be called by "ForEach()" (since the tuple is
-    // empty). "operator()" is still specialized on zero however
-    // because when "ForEach()" is stamped out on the template args
-    // we pass it, "IsForEachFunctor_v" is called to check if the
-    // 2nd template arg of "ForEach()" is a valid functor type. This
-    // occurs via a "static_assert" in C++17 or a concept in C++20
-    // or later, but in either case "IsForEachFunctor_v" is called
-    // and the implementation for this stamps out a copy of the
-    // functor's "operator()" template arg, again, doing so with
-    // template arg zero (0). "operator()" isn't actually called at
-    // this time however, only stamped out (specialized on template
-    // arg zero), simply to make sure the functor type being passed
-    // is valid. If not then "IsForEachFunctor_v" will return false
-    // and the "static_assert" in C++17 or concept in C++20 or later
-    // will correctly trap the situation at compile time (i.e., an
-    // invalid type is being passed for the 2nd template arg of
-    // "ForEach"). However, if the 1st template arg of "ForEach",
-    // namely "N" (the number of iterations it will be called for),
-    // is zero itself, then although the functor's "operator()"
-    // template member will never be called since "N" is zero as
-    // noted (so there will beno iterations), "IsForEachFunctor_v"
-    // itself will still stamp out "operator()" with its
-    // "std::size_t" template arg set to zero (0) as just described.
-    // Note that "IsForEachFunctor_v" has no choice but to stamp out
-    // "operator()" since there's no other way in C++ for it do its
-    // job at this writing (check if a type is a functor with a
-    // template member, in this case "operator()" with a
-    // "std::size_t" template arg).
-    //
-    // There's a problem with this situation however. Our
-    // (identical) implementation of "operator()" seen in both the
-    // lambda below (for C++20 and later), or in class
-    // "Private::ProcessTupleType" (C++17 only), both call
-    // "std::tuple_element_t<I, TupleT>", but if the "TupleT"
-    // template are we're passing to this is empty, then it's
-    // illegal to call it for any index including zero (since the
-    // tuple is empty so even index zero is out of bounds). Template
-    // "I" in this call (zero) is therefore an invalid index so
-    // compilation will therefore fail (but not in C++17 for reasons
-    // unknown - read on). The upshot is that when dealing with an
-    // empty tuple, i.e., the "TupleT" template arg of the function
-    // you're now reading is empty, we can't call "ForEach()"
-    // because even though it won't iterate the functor it's being
-    // passed (since the "N" template arg of "ForEach()" will be
-    // zero in this case), the call to "IsForEachFunctor_v" that
-    // occurs merely by stamping out "ForEach()" will cause the call
-    // to "std::tuple_element_t<I, TupleT>" in our functor to choke
-    // during compilation (since it's stamped out with its "I"
-    // template arg set to zero but the "TupleT" template arg is
-    // empty so "I" is an illegal index). Again, this occurs even
-    // though the code is never actually called, but it's illegal
-    // even to stamp it out in this case.
-    //
-    // Please note that as previously mentioned, this situation only
-    // occurs in C++20 or later. In this case the lambda seen in the
-    // code below would trigger the problem without explicit action
-    // to circumvent it (which the following "if constexpr" does),
-    // but in C++17 the problem doesn't occur. In C++17 the same
-    // code seen in the lambda below exists but in
-    // "Private::ProcessTupleType::operator()" instead (the lambda
-    // below targets C++20 or later only), but for reasons unknown
-    // (I haven't investigated), in C++17 no compilation error
-    // occurs on the call to "std::tuple_element_t<I, TupleT>" (as
-    // described). It's likely (presumably) not being stampled out
-    // in this case. Testing shows however that if we allowed the
-    // same code to be compiled in C++20, instead of the lambda
-    // below (that we actually rely on in C++20 or later), it will
-    // also fail. IOW, this whole situation surrounding
-    // "std::tuple_element_t<I, TupleT>" only starts surfacing in
-    // C++20 so something clearly has changed between C++17 and
-    // C++20 (since what compiled without error in C++17 now fails
-    // in C++20). This should be investigated but it's a moot point
-    // for now since the following "if constexpr" statemement
-    // prevents the issue altogether
-    /////////////////////////////////////////////////////////////////
-    if constexpr (std::tuple_size_v<TupleT> != 0)
+    static_assert(IsFreeFunction_v<F>, "\"F\" must be a free function signature (or pointer or reference to one)");
+
+public:
+    using Private::DelegateImpl<F, BufferSize>::DelegateImpl;
+};
+
+///////////////////////////////////////////////////////////////////////////
+// For internal use only (by "DispatchEntry" and "DispatchTable" just
+// after this namespace)
+///////////////////////////////////////////////////////////////////////////
+STDEXT_BEGIN_PRIVATE
+{
+    ///////////////////////////////////////////////////////////////////////
+    // Default key of a "DispatchEntry" (see this for details), the
+    // "TypeHash_v" of the handler's first arg (after removing any
+    // reference and cv-qualifiers, so "const Message &" and "Message"
+    // yield the same key)
+    ///////////////////////////////////////////////////////////////////////
+    template <auto HandlerT>
+    inline constexpr std::uint64_t DefaultDispatchKey = TypeHash_v<RemoveCvRef<ArgType_t<decltype(HandlerT), 0>>>;
+
+    ///////////////////////////////////////////////////////////////////////
+    // Returns the smallest power of 2 that's greater than or equal to
+    // twice "count" (the number of slots used by "DispatchTable" to
+    // store "count" entries - the extra space makes it much easier to
+    // find a perfect hash), and its (base 2) logarithm. Also used by
+    // "FunctionRegistry" (which keeps its table at most half full).
+    ///////////////////////////////////////////////////////////////////////
+    inline constexpr unsigned DispatchTableLog2Size(std::size_t count) noexcept
     {
-        // Lambda templates not supported until C++20
-        #if CPP20_OR_LATER
-            ////////////////////////////////////////////////////////
-            // Lambda template we'll be calling once for each type
-            // in template arg "TupleT" (equivalent to the
-            // "Private::ProcessTupleType" functor in C++17 or
-            // earlier below). Each iteration invokes "functor",
-            // where processing stops after all types in "TupleT"
-            // have been processed or "functor" returns false,
-            // whichever comes first  (false only returned if
-            // "functor" wants to break like a normal "for" loop,
-            // which rarely happens in practice so we usually
-            // iterate all tuple types in "TupleT")
-            //
-            // IMPORTANT:
-            // ---------
-            // See the IMPORTANT comments about the capture of
-            // "functor" in function template "ForEach()" (in the
-            // comments preceding its own lambda template). The
-            // same situation described there applies here as well.
-            ////////////////////////////////////////////////////////
-            const auto processTupleType = [&functor]<std::size_t I>()
-                                          {
-                                              using TupleElement_t = std::tuple_element_t<I, TupleT>;
+        unsigned log2Size = 1;
+        while ((std::size_t(1) << log2Size) < count * 2)
+        {
+            ++log2Size;
+        }
 
-                                              /////////////////////////////////////////////////////
-                                              // IMPORTANT:
-                                              // ---------
-                                              // See the IMPORTANT comments inside the lambda of
-                                              // function template "ForEach()" (just before its
-                                              // own call to "std::forward()"). The same situation
-                                              // described there applies here as well.
-                                              /////////////////////////////////////////////////////
-                                              return std::forward<ForEachTupleFunctorT>(functor).template operator()<I, TupleElement_t>();
-                                          };
-        #else // C++17 (using our own functor instead, equivalent to above lambda) ...
-            ////////////////////////////////////////////////////////////
-            // Create an instance of "Private::ProcessTupleType", a
-            // functor we'll be calling once for each type in template
-            // arg "TupleT" (equivalent to the lambda in C++20 or later
-            // above). Each iteration invokes "functor", where
-            // processing stops after all types in "TupleT" have been
-            // processed or "functor" returns false, whichever comes
-            // first (false only returned if "functor" wants to break
-            // like a normal "for" loop, which rarely happens in
-            // practice so we usually iterate all types in "TupleT")
-            //
-            // Note: The "ForEachTupleFunctorT" template arg we're
-            // passing here as the 2nd template arg of class of
-            // "Private::ProcessTupleType" means that the latter's
-            // constructor will take the same arg type as "functor"
-            // itself (& or && as usual). We then call "std::forward"
-            // as seen to pass "functor" to the constructor. Note that
-            // "std::forward" is mandatory here because "functor" is an
-            // lvalue even in the && case (since it's named - named
-            // rvalue references are still lvalues). Attempting to pass
-            // "functor" directly would therefore cause a compiler
-            // error since you can't bind an lvalue (functor) to an
-            // rvalue reference (the arg type that the
-            // "Private::ProcessTupleType" constructor is expecting in
-            // this case).
-            ////////////////////////////////////////////////////////////
-            const Private::ProcessTupleType<TupleT, ForEachTupleFunctorT> processTupleType(std::forward<ForEachTupleFunctorT>(functor));
-        #endif
+        return log2Size;
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // Returns true if any 2 keys in "keys" are the same
+    ///////////////////////////////////////////////////////////////////////
+    template <std::size_t N>
+    inline constexpr bool HasDuplicateKeys(const std::uint64_t (&keys)[N]) noexcept
+    {
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            for (std::size_t j = i + 1; j < N; ++j)
+            {
+                if (keys[i] == keys[j])
+                {
+                    return true;
+                }
+            }
+        }
 
-        ///////////////////////////////////////////////////////////////
-        // Defer to this function template further above, passing the
-        // number of elements in the tuple as the function's template
-        // arg, and "processTupleType" as the function's functor arg.
-        // The "ForEachFunctorT" template arg of "ForEach()" is
-        // therefore deduced to be the type of "processTupleType".
-        // "ForEach()" will then invoke this functor once for each
-        // element in the tuple given by "TupleT".
-        ///////////////////////////////////////////////////////////////
-        return ForEach<std::tuple_size_v<TupleT>>(processTupleType);
+        return false;
     }
-    else
+
+    ///////////////////////////////////////////////////////////////////////
+    // Bijective 64-bit mixing function (the "splitmix64" finalizer) used
+    // by "DispatchTableBucket()" and "DispatchTableSlot()" just below, so
+    // that every bit of the key affects every bit of the result
+    ///////////////////////////////////////////////////////////////////////
+    inline constexpr std::uint64_t DispatchTableMix(std::uint64_t value) noexcept
     {
-        return true;
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+        return value ^ (value >> 31);
     }
-}
 
-/////////////////////////////////////////////////////////////////////////
-// ForEachFunctionTraitsArg(). Iterates all tuple elements in member
-// "FunctionTraitsT::ArgTypes", where "FunctionTraitsT" is a
-// "FunctionTraits" specialization, and invokes the given "functor"
-// for each. Also see helper function "ForEachArg()" just below which
-// just defers to the function you're now reading (and easier to use
-// so you should normally use it instead - the function you're now
-// reading should normally be used only if you already have an
-// existing "FunctionTraits" you're working with, otherwise
-// "ForEachArg()" creates a "FunctionTraits" for you so it's less
-// verbose than calling the following function directly).
-//
-// The effect of this function is that all (non-variadic) args in the
-// function that the given "FunctionTraits" was specialized on are
-// iterated or none if that function has no args. For each argument
-// type, the given "functor" is invoked as noted. "functor" must be a
-// functor with the following functor (template) signature (where
-// items in square brackets are optional - note that an invalid
-// functor will trigger the FOR_EACH_TUPLE_FUNCTOR_C concept in C++20
-// or later, or a "static_assert" in C++17, since we don't support
-// earlier versions - compile fails either way):
+    ///////////////////////////////////////////////////////////////////////
+    // First level hash of "DispatchTable" (see "DispatchTableLayout"
+    // below). Returns the bucket "key" belongs to, where "bucketCount"
+    // is a power of 2.
+    ///////////////////////////////////////////////////////////////////////
+    inline constexpr std::size_t DispatchTableBucket(std::uint64_t key, std::size_t bucketCount) noexcept
+    {
+        return static_cast<std::size_t>(DispatchTableMix(key) & (bucketCount - 1));
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // Second level hash of "DispatchTable" (see "DispatchTableLayout"
+    // below). Returns the slot "key" is stored in given the displacement
+    // of its bucket, keeping the top "64 - shift" bits of the hash (so
+    // the result is always less than "2 ^ (64 - shift)"). Each
+    // displacement yields an unrelated slot for the same key.
+    ///////////////////////////////////////////////////////////////////////
+    inline constexpr std::size_t DispatchTableSlot(std::uint64_t key, std::uint32_t displacement, unsigned shift) noexcept
+    {
+        return static_cast<std::size_t>(DispatchTableMix(key + (displacement + 1ULL) * 0x9E3779B97F4A7C15ULL) >> shift);
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // DispatchTableLayout. Perfect hash of the keys of a "DispatchTable"
+    // with "SizeT" slots, created by "MakeDispatchTableLayout()" just
+    // below using the "hash and displace" technique (also known as
+    // "CHD"). Keys are first distributed into "BucketCount" buckets by
+    // "DispatchTableBucket()", and each bucket is then assigned the
+    // smallest displacement for which "DispatchTableSlot()" maps every
+    // key in the bucket to a distinct, unused slot (largest buckets
+    // first, while most slots are still free). Since each bucket holds
+    // just a key or 2 on average, and the table is never more than half
+    // full, a displacement is normally found after a few tries, so
+    // creating the layout costs time roughly linear in the number of
+    // keys (whereas a single hash function that's collision-free for
+    // all keys practically never exists once there are more than a few
+    // dozen keys). Looking up a key costs one extra (small) array
+    // access to read its bucket's displacement. "m_Keys" stores the key
+    // in each slot, where unused slots store "unusedKey" (see
+    // "MakeDispatchTableLayout()"), and "m_Found" is false if a
+    // displacement couldn't be found for some bucket (which should never
+    // occur for distinct keys - "DispatchTable" then fails to compile).
+    ///////////////////////////////////////////////////////////////////////
+    inline constexpr std::uint32_t MaxDispatchTableDisplacement = 1U << 16;
+
+    template <std::size_t SizeT>
+    struct DispatchTableLayout
+    {
+        static constexpr std::size_t BucketCount = SizeT / 2;
+
+        std::uint32_t m_Displacements[BucketCount] = {};
+        std::uint64_t m_Keys[SizeT] = {};
+        bool m_Found = false;
+
+        constexpr std::size_t IndexOf(std::uint64_t key, unsigned shift) const noexcept
+        {
+            return DispatchTableSlot(key, m_Displacements[DispatchTableBucket(key, BucketCount)], shift);
+        }
+    };
+
+    template <std::size_t SizeT, std::size_t N>
+    inline constexpr DispatchTableLayout<SizeT> MakeDispatchTableLayout(const std::uint64_t (&keys)[N],
+                                                                        std::uint64_t unusedKey,
+                                                                        unsigned shift) noexcept
+    {
+        constexpr std::size_t BucketCount = DispatchTableLayout<SizeT>::BucketCount;
+
+        DispatchTableLayout<SizeT> layout{};
+        for (std::uint64_t &key : layout.m_Keys)
+        {
+            key = unusedKey;
+        }
+
+        std::size_t bucketOf[N] = {};
+        std::size_t bucketSizes[BucketCount] = {};
+        std::size_t maxBucketSize = 0;
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            bucketOf[i] = DispatchTableBucket(keys[i], BucketCount);
+            maxBucketSize = std::max(maxBucketSize, ++bucketSizes[bucketOf[i]]);
+        }
+
+        bool used[SizeT] = {};
+        std::size_t placed[N] = {};
+        for (std::size_t bucketSize = maxBucketSize; bucketSize != 0; --bucketSize)
+        {
+            for (std::size_t bucket = 0; bucket < BucketCount; ++bucket)
+            {
+                if (bucketSizes[bucket] != bucketSize)
+                {
+                    continue;
+                }
+
+                for (std::uint32_t displacement = 0;; ++displacement)
+                {
+                    if (displacement == MaxDispatchTableDisplacement)
+                    {
+                        return layout; // "m_Found" is false
+                    }
+
+                    ///////////////////////////////////////////////
+                    // Claim the slot of each key in the bucket,
+                    // releasing all slots claimed so far if any of
+                    // them is already used (so try the next
+                    // displacement)
+                    ///////////////////////////////////////////////
+                    std::size_t placedCount = 0;
+                    for (std::size_t i = 0; i < N; ++i)
+                    {
+                        if (bucketOf[i] == bucket)
+                        {
+                            const std::size_t slot = DispatchTableSlot(keys[i], displacement, shift);
+                            if (used[slot])
+                            {
+                                break;
+                            }
+
+                            used[slot] = true;
+                            placed[placedCount++] = i;
+                        }
+                    }
+
+                    if (placedCount == bucketSize)
+                    {
+                        layout.m_Displacements[bucket] = displacement;
+                        for (std::size_t j = 0; j < placedCount; ++j)
+                        {
+                            layout.m_Keys[DispatchTableSlot(keys[placed[j]], displacement, shift)] = keys[placed[j]];
+                        }
+
+                        break;
+                    }
+
+                    for (std::size_t j = 0; j < placedCount; ++j)
+                    {
+                        used[DispatchTableSlot(keys[placed[j]], displacement, shift)] = false;
+                    }
+                }
+            }
+        }
+
+        layout.m_Found = true;
+        return layout;
+    }
+} // namespace Private
+STDEXT_END_PRIVATE
+
+/////////////////////////////////////////////////////////////////////////////
+// DispatchEntry. Describes a single handler in a "DispatchTable" (see this
+// for details), where "HandlerT" is a pointer to the (free) function that
+// handles the entry, and "KeyT" is the key that selects it. If "KeyT"
+// isn't passed then it defaults to the "TypeHash_v" of the handler's first
+// arg (after removing any reference and cv-qualifiers), so handlers that
+// take a message type as their first arg are normally keyed on that type
+// without having to do anything. To key the handler on a tag of your own
+// instead just pass it as "KeyT" ("Fnv1aHash()" can be used to produce one
+// from a name if required).
+/////////////////////////////////////////////////////////////////////////////
+template <auto HandlerT,
+          std::uint64_t KeyT = Private::DefaultDispatchKey<HandlerT>>
+struct DispatchEntry
+{
+    static_assert(IsFreeFunction_v<decltype(HandlerT)>, "\"HandlerT\" must be a pointer to a free function");
+
+    static constexpr auto Handler = HandlerT;
+    static constexpr std::uint64_t Key = KeyT;
+};
+
+/////////////////////////////////////////////////////////////////////////////
+// DispatchTable. Compile-time dispatch table for the given "EntriesT" (each
+// a "DispatchEntry" - see this for details). The table is a perfect hash
+// computed entirely at compile time, where each slot stores the key of
+// its entry and a (trampoline) function that invokes the entry's handler.
+// The handler's arguments are produced by a "decoder" (the same type of
+// functor passed to "InvokeWithDecoder()" which each trampoline defers to
+// - see this for details), so each handler's own "FunctionTraits" (its
+// argument types) determine what gets decoded. Dispatching a key
+// therefore costs 2 (cheap) hashes and a read of a small displacement
+// table (see "Private::DispatchTableLayout"), one compare and one
+// indirect call, and nothing is ever allocated (the tables are
+// "constexpr" so they're normally placed in read-only memory). Note
+// that the handlers' return values (if any) are discarded.
 //
-//     template <std::size_t I, typename ArgTypeT>
-//     bool operator()() [const] [volatile] [ref-qualifier] [noexcept];
+//     Example
+//     -------
+//     void OnLogin(const LoginMessage &);
+//     void OnLogout(const LogoutMessage &);
+//     void OnPing(int id); // Keyed on a tag (see below)
 //
-// Note that lambdas with this signature are also (therefore)
-// supported in C++20 or later (since lambda templates aren't
-// supported in earlier versions of C++ so you'll have to roll your
-// own functor template if targeting C++17). Note that free functions
-// or other non-static member functions besides "operator()" are not
-// currently supported (but may be in a future release):
+//     using Router = DispatchTable<DispatchEntry<&OnLogin>,  // Keyed on "TypeHash_v<LoginMessage>"
+//                                  DispatchEntry<&OnLogout>, // Keyed on "TypeHash_v<LogoutMessage>"
+//                                  DispatchEntry<&OnPing, Fnv1aHash(std::string_view("Ping"))>>;
 //
+//     //////////////////////////////////////////////////////////
+//     // Invoke the handler for "key" (normally read from the
+//     // message header), where "decoder" decodes the handler's
+//     // arguments from the message (returns false if no
+//     // handler exists for "key")
+//     //////////////////////////////////////////////////////////
+//     const bool found = Router::Dispatch(key, decoder);
+/////////////////////////////////////////////////////////////////////////////
+template <typename... EntriesT>
+class DispatchTable
+{
+    static_assert(sizeof...(EntriesT) != 0, "At least one \"DispatchEntry\" must be passed");
+
+public:
+    // Number of entries in the table
+    static constexpr std::size_t Count = sizeof...(EntriesT);
+
+private:
+    static constexpr std::uint64_t Keys[] = {EntriesT::Key...};
+    static_assert(!Private::HasDuplicateKeys(Keys), "Each \"DispatchEntry\" must have a unique key");
+
+    static constexpr unsigned Log2Size = Private::DispatchTableLog2Size(Count);
+    static constexpr std::size_t Size = std::size_t(1) << Log2Size;
+    static constexpr unsigned Shift = 64 - Log2Size;
+    static constexpr Private::DispatchTableLayout<Size> Layout = Private::MakeDispatchTableLayout<Size>(Keys, Keys[0], Shift);
+    static_assert(Layout.m_Found, "Unable to find a perfect hash for the given keys");
+
+    static constexpr std::size_t IndexOf(std::uint64_t key) noexcept
+    {
+        return Layout.IndexOf(key, Shift);
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Trampoline for "EntryT" that decodes the arguments of
+    // its handler using "decoder" and invokes the handler
+    // (directly, by way of "ValueTraits", so the call is
+    // never made through a function pointer)
+    ///////////////////////////////////////////////////////////
+    template <typename DecoderT, typename EntryT>
+    static void Trampoline(DecoderT &decoder)
+    {
+        using HandlerT = RemoveCvRef<decltype(EntryT::Handler)>;
+
+        Private::InvokeWithDecoderImpl<HandlerT>(ValueTraits<EntryT::Handler>{},
+                                                 decoder,
+                                                 std::make_index_sequence<ArgCount_v<HandlerT>>());
+    }
+
+    template <typename DecoderT>
+    struct Slot
+    {
+        std::uint64_t m_Key = 0;
+        void (*m_Trampoline)(DecoderT &) = nullptr;
+    };
+
+    template <typename DecoderT>
+    struct Slots
+    {
+        Slot<DecoderT> m_Slots[Size];
+    };
+
+    ////////////////////////////////////////////////////////////////
+    // Creates the slots for all entries, where each entry is stored
+    // in the slot given by "IndexOf()" (its key). Unused slots store
+    // the key of the first entry, which never maps to an unused slot
+    // (since that entry is stored in its own slot), so looking up
+    // any key that's not in the table always fails the (single) key
+    // comparison in "Dispatch()" (and no separate check for unused
+    // slots is required).
+    ////////////////////////////////////////////////////////////////
+    template <typename DecoderT>
+    static constexpr Slots<DecoderT> MakeSlots() noexcept
+    {
+        Slots<DecoderT> slots{};
+        for (auto &slot : slots.m_Slots)
+        {
+            slot.m_Key = Keys[0];
+        }
+
+        ((slots.m_Slots[IndexOf(EntriesT::Key)] = Slot<DecoderT>{EntriesT::Key, &Trampoline<DecoderT, EntriesT>}), ...);
+
+        return slots;
+    }
+
+    template <typename DecoderT>
+    static constexpr Slots<DecoderT> s_Slots = MakeSlots<DecoderT>();
+
+public:
+    // Returns true if "key" is in the table or false otherwise
+    static constexpr bool Contains(std::uint64_t key) noexcept
+    {
+        return Layout.m_Keys[IndexOf(key)] == key;
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Invokes the handler for "key", decoding its arguments via
+    // "decoder" (see "InvokeWithDecoder()"). Returns true if a
+    // handler was found for "key" or false otherwise (in which case
+    // nothing is invoked).
+    ////////////////////////////////////////////////////////////////
+    template <typename DecoderT>
+    static bool Dispatch(std::uint64_t key, DecoderT &&decoder)
+    {
+        const Slot<std::remove_reference_t<DecoderT>> &slot = s_Slots<std::remove_reference_t<DecoderT>>.m_Slots[IndexOf(key)];
+        if (slot.m_Key == key)
+        {
+            slot.m_Trampoline(decoder);
+            return true;
+        }
+
+        return false;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////
+// For internal use only (by "BatchInvoke()" just after this namespace)
+///////////////////////////////////////////////////////////////////////////
+STDEXT_BEGIN_PRIVATE
+{
+    ///////////////////////////////////////////////////////////////////////
+    // IsForEachPolicy_v. "true" if "T" is one of the execution policies
+    // declared further above ("ForEachSequencedPolicy", etc.)
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T>
+    inline constexpr bool IsForEachPolicy_v = std::is_same_v<RemoveCvRef<T>, ForEachSequencedPolicy> ||
+                                              #if defined(STDEXT_USE_THREADS)
+                                                  std::is_same_v<RemoveCvRef<T>, ForEachParallelPolicy> ||
+                                              #endif
+                                              std::is_same_v<RemoveCvRef<T>, ForEachUnsequencedPolicy>;
+
+    ///////////////////////////////////////////////////////////////////////
+    // BatchInvokeArg_t. How "BatchInvoke()" passes an element of type
+    // "ElementT" (the element type of a column) to a parameter of type
+    // "ArgTypeT", i.e., as an rvalue if the parameter is an rvalue
+    // reference (so the element is moved from its column), or as an
+    // lvalue otherwise (so by-value parameters are copied from the
+    // column, leaving it intact).
+    ///////////////////////////////////////////////////////////////////////
+    template <typename ArgTypeT, typename ElementT>
+    using BatchInvokeArg_t = std::conditional_t<std::is_rvalue_reference_v<ArgTypeT>, ElementT &&, ElementT &>;
+
+    ///////////////////////////////////////////////////////////////////////
+    // BatchInvokeLoop(). The actual loop "BatchInvoke()" relies on,
+    // invoking "function" for each row in the range "begin" to "end"
+    // (EXclusive), where each arg is read from its own column (given by
+    // "columns", a pointer to the first element of each column, passed
+    // as per "BatchInvokeArg_t" just above), and the result (if not
+    // void) is stored in "out". Note that all columns are passed as
+    // (local) pointers so the compiler knows they can't change during
+    // the loop, which makes it a candidate for auto-vectorization when
+    // "function" can be inlined. Only "noexcept" if every step of a row
+    // is, i.e., the call itself (including initializing each parameter
+    // from its column, which may copy it) and storing the result in
+    // "out" (see "IsBatchInvokeRowNoexcept()" just below), not just "F"
+    // itself.
+    ///////////////////////////////////////////////////////////////////////
+    template <typename FunctionT, typename OutT, typename... ArgTs>
+    inline constexpr bool IsBatchInvokeRowNoexcept() noexcept
+    {
+        if constexpr (std::is_void_v<OutT>)
+        {
+            return noexcept(std::declval<FunctionT &>()(std::declval<ArgTs>()...));
+        }
+        else
+        {
+            return noexcept(std::declval<OutT &>() = std::declval<FunctionT &>()(std::declval<ArgTs>()...));
+        }
+    }
+
+    template <typename F, typename FunctionT, typename OutT, std::size_t... Is, typename... ColumnTs>
+    inline void BatchInvokeLoop(FunctionT &function,
+                                OutT *const out,
+                                const std::size_t begin,
+                                const std::size_t end,
+                                std::index_sequence<Is...>,
+                                ColumnTs *const... columns) noexcept(IsBatchInvokeRowNoexcept<FunctionT, OutT, BatchInvokeArg_t<ArgType_t<F, Is>, ColumnTs>...>())
+    {
+        for (std::size_t row = begin; row < end; ++row)
+        {
+            if constexpr (std::is_void_v<ReturnType_t<F>>)
+            {
+                function(static_cast<BatchInvokeArg_t<ArgType_t<F, Is>, ColumnTs>>(columns[row])...);
+            }
+            else
+            {
+                out[row] = function(static_cast<BatchInvokeArg_t<ArgType_t<F, Is>, ColumnTs>>(columns[row])...);
+            }
+        }
+    }
+
+    template <typename F, typename FunctionT, typename ColumnsTupleT, std::size_t... Is>
+    inline void BatchInvokeRows(FunctionT &function,
+                                ColumnsTupleT &columns,
+                                const std::size_t begin,
+                                const std::size_t end,
+                                std::index_sequence<Is...> indexes)
+    {
+        static_assert(std::is_invocable_v<FunctionT &,
+                                          BatchInvokeArg_t<ArgType_t<F, Is>,
+                                                           std::remove_pointer_t<decltype(std::get<Is>(columns).data())>>...>,
+                      "Each column's elements must be passable to the corresponding argument of \"function\" (note "
+                      "that elements are moved from their column to args taken by \"&&\", so such a column can't be \"const\", "
+                      "and args taken by non-\"const\" \"&\" can't be read from a \"const\" column either)");
+
+        if constexpr (std::is_void_v<ReturnType_t<F>>)
+        {
+            BatchInvokeLoop<F>(function, static_cast<void *>(nullptr), begin, end, indexes, std::get<Is>(columns).data()...);
+        }
+        else
+        {
+            BatchInvokeLoop<F>(function, std::get<sizeof...(Is)>(columns).data(), begin, end, indexes, std::get<Is>(columns).data()...);
+        }
+    }
+
+    // Number of rows processed by "BatchInvoke()" (the size of its smallest column)
+    template <typename ColumnsTupleT, std::size_t... Is>
+    inline std::size_t BatchInvokeRowCount(const ColumnsTupleT &columns, std::index_sequence<Is...>) noexcept
+    {
+        std::size_t rowCount = static_cast<std::size_t>(-1);
+        ((rowCount = std::min(rowCount, static_cast<std::size_t>(std::get<Is>(columns).size()))), ...);
+        return rowCount;
+    }
+} // namespace Private
+STDEXT_END_PRIVATE
+
+/////////////////////////////////////////////////////////////////////////////
+// BatchInvoke(). Invokes "function" once for each row of a batch of
+// arguments stored in columnar (structure-of-arrays) form, where
+// "columns" consists of one column (container) for each (non-variadic)
+// argument of "function" (in the same order), followed by one more column
+// that receives the return value of each call ("out" - omit it if
+// "function" returns "void"). A column is any contiguous container
+// supporting "data()" and "size()" (such as "std::vector", "std::array"
+// or in C++20, "std::span"), where the element type of the "Ith"
+// column is normally "RemoveCvRef<ArgType_t<F, I>>" and that of "out" is
+// "ReturnType_t<F>" ("F" being the type of "function", i.e., any free
+// function or functor). Row "R" therefore invokes "function" with
+// element "R" of each argument column and stores the result in element
+// "R" of "out". Each element is passed as an lvalue (so by-value args are
+// copied from their column), except to args taken by rvalue reference
+// ("&&"), which the element is moved to (leaving it in its moved-from
+// state in the column). Returns the number of rows processed, which is
+// the size of the smallest column (so normally all columns should be the
+// same size). Note that when "function" can be inlined (it's "inline" or
+// a lambda for instance), the loop that processes the rows is normally a
+// candidate for auto-vectorization by the compiler (in particular when
+// "function" is "noexcept").
 //
 //     Example
 //     -------
-//     ////////////////////////////////////////////////////
-//     // Prototype of some function whose arg types you
-//     // wish to iterate (display in this example - see
-//     // "displayArgType" lambda below). Note that we're
-//     // using a raw C++ function type in this example
-//     // (just a free-function prototype), but pointers
-//     // and references to functions are also supported
-//     // (though references to non-static member functions
-//     // are illegal in C++), as well as references to
-//     // pointers, and non-overloaded functors (or
-//     // references to functors)
-//     ////////////////////////////////////////////////////
-//     int SomeFunc(int arg1, float arg2, double arg3);
-//
-//     ///////////////////////////////////////////////////////////////
-//     // "FunctionTraits" specialization for the above function.
-//     // Note that you can pass any function type for its template
-//     // arg (free functions, member functions, pointers to
-//     // functions, references to functions, references to pointers
-//     // to functions and non-overloaded functors). The resulting
-//     // "FunctionTraits" specialization therefore captures all
-//     // (most) info about whatever function you pass (its return
-//     // type, argument types and other info). See "FunctionTraits"
-//     // for details (we'll be iterating its "ArgTypes" member
-//     // below).
-//     ///////////////////////////////////////////////////////////////
-//     using SomeFuncTraits = FunctionTraits<decltype(SomeFunc)>;
-//
-//     /////////////////////////////////////////////////////////////////
-//     // Lambda that will be invoked just below, once for each arg in
-//     // "SomeFunc()" above (where template arg "I" is the zero-based
-//     // "Ith" argument of "SomeFunc()", and "ArgTypeT" is its type).
-//     // Note that lambda templates are supported in C++20 and later
-//     // only. For C++17 (this header doesn't support earlier versions),
-//     // you need to roll your own functor instead (with a template
-//     // version of "operator()" equivalent to this lambda)
-//     /////////////////////////////////////////////////////////////////
-//     const auto displayArgType = []<std::size_t I, typename ArgTypeT>()
-//                                 {
-//                                     /////////////////////////////////////////////////////////
-//                                     // Display the type of the (zero-based) "Ith" arg in
-//                                     // "SomeFunc" using the following format (shown here for
-//                                     // "I" equals zero so "ArgTypeT" is therefore an "int",
-//                                     // but whatever "I" and "ArgTypeT" are on each iteration
-//                                     // - note that we increment zero-based "I" by 1 however
-//                                     // to display it as 1-based since it's more natural for
-//                                     // display purposes):
-//                                     //
-//                                     //    1) int
-//                                     //
-//                                     // Note that we never come through here if the function
-//                                     // represented by "FunctionTraitsT" has no "args (or
-//                                     // variadic args only - variadic args aren't processed)
-//                                     /////////////////////////////////////////////////////////
-//                                     tcout << (I + 1) << _T(") ") << TypeName_v<ArgTypeT> << _T("\n");
+//     inline double Price(double spot, double strike, double rate) noexcept;
 //
-//                                     //////////////////////////////////////////////
-//         // Return true to continue iterating (false
-//         // would stop iterating, equivalent to a
-//         // "break" statement in a regular "for" loop)
-//         //////////////////////////////////////////////
-//         return true;
-//     };
+//     std::vector<double> spots, strikes, rates, prices; // Same size
+//     BatchInvoke(Price, spots, strikes, rates, prices);
 //
-//     /////////////////////////////////////////////////////////////
-//     // Iterate all tuple elements in "SomeFuncTraits::ArgTypes"
-//     // meaning once for each argument in "SomeFunc()" above.
-//     // Invokes "displayArgType" above for each. Outputs the
-//     // following:
-//     //
-//     //     1) int
-//     //     2) float
-//     //     3) double
-//     //
-//     // Note that "ForEachFunctionTraitsArg()" returns true if
-//     // the functor you pass ("displayArgType" in this example)
-//     // returns true or false otherwise (useful if your functor
-//     // needs to "break" like a normal "for" loop for any
-//     // reason - iteration immediately stops if it returns false
-//     // and the following therefore returns false). Always
-//     // returns true in the above example (and typically in most
-//     // real-world code as well)
-//     /////////////////////////////////////////////////////////////
-//     ForEachFunctionTraitsArg<SomeFuncTraits>(displayArgType);
-/////////////////////////////////////////////////////////////////////////
-template <FUNCTION_TRAITS_C FunctionTraitsT,
-          FOR_EACH_TUPLE_FUNCTOR_C ForEachTupleFunctorT>
-inline constexpr bool ForEachFunctionTraitsArg(ForEachTupleFunctorT&& functor)
+// Lastly, note that the overload just below also takes an execution
+// policy, allowing you to process the rows on multiple threads (see
+// the overload for details).
+/////////////////////////////////////////////////////////////////////////////
+template <typename FunctionT,
+          typename... ColumnsT,
+          typename = std::enable_if_t<!Private::IsForEachPolicy_v<FunctionT>>>
+inline std::size_t BatchInvoke(FunctionT &&function, ColumnsT &&... columns)
 {
-    // See this constant for details
-    #if !CONCEPTS_SUPPORTED
-        /////////////////////////////////////////////////////
-        // Kicks in if concepts not supported, otherwise
-        // FUNCTION_TRAITS_C concept kicks in above instead
-        // (latter simply resolves to the "typename" keyword
-        // when concepts aren't supported)
-        /////////////////////////////////////////////////////
-        STATIC_ASSERT_IS_FUNCTION_TRAITS(FunctionTraitsT);
+    return BatchInvoke(ForEachSequenced, std::forward<FunctionT>(function), std::forward<ColumnsT>(columns)...);
+}
 
-        ///////////////////////////////////////////////
-        // Kicks in if C++ 17 or earlier, otherwise
-        // FOR_EACH_TUPLE_FUNCTOR_C concept kicks in
-        // above instead (latter simply resolves to
-        // the "typename" keyword in C++17 or earlier)
-        ///////////////////////////////////////////////
-        STATIC_ASSERT_IS_FOR_EACH_TUPLE_FUNCTOR(ForEachTupleFunctorT)
+/////////////////////////////////////////////////////////////////////////////
+// BatchInvoke(). Overload of the function just above taking an execution
+// policy ("ForEachSequenced", "ForEachUnsequenced" or if STDEXT_USE_THREADS
+// is #defined, "ForEachParallel" - see these for details). The first two
+// process all rows on the calling thread (there's no difference between
+// them here since rows never depend on each other). "ForEachParallel"
+// splits the rows into contiguous chunks of (at least) 4096 rows, one
+// per thread of its "TaskPool" plus the calling thread (see
+// "ForEachParallel" for details), processed concurrently so "function"
+// must be safe to invoke concurrently. If "function" throws then the
+// rest of that chunk is skipped, and once all chunks are done the first
+// exception thrown is rethrown (the other chunks are always fully
+// processed).
+/////////////////////////////////////////////////////////////////////////////
+template <typename PolicyT,
+          typename FunctionT,
+          typename... ColumnsT,
+          typename = std::enable_if_t<Private::IsForEachPolicy_v<PolicyT>>>
+inline std::size_t BatchInvoke([[maybe_unused]] const PolicyT policy, FunctionT &&function, ColumnsT &&... columns)
+{
+    using F = RemoveCvRef<FunctionT>;
+    static_assert(IsTraitsFunction_v<F>, "\"function\" must be a free function or functor");
+
+    constexpr std::size_t ArgCount = ArgCount_v<F>;
+    constexpr std::size_t ColumnCount = ArgCount + (std::is_void_v<ReturnType_t<F>> ? 0 : 1);
+    static_assert(sizeof...(ColumnsT) == ColumnCount,
+                  "One column must be passed for each (non-variadic) argument of \"function\", followed by "
+                  "the output column (omitted only if \"function\" returns \"void\")");
+
+    auto columnsTuple = std::forward_as_tuple(columns...);
+    const std::size_t rowCount = Private::BatchInvokeRowCount(columnsTuple, std::make_index_sequence<ColumnCount>());
+
+    #if defined(STDEXT_USE_THREADS)
+        if constexpr (std::is_same_v<RemoveCvRef<PolicyT>, ForEachParallelPolicy>)
+        {
+            constexpr std::size_t minRowsPerChunk = 4096;
+
+            ///////////////////////////////////////////////////////////
+            // One contiguous chunk of (at least) "minRowsPerChunk"
+            // rows per thread of the pool (plus the calling thread),
+            // each claimed by whichever thread is free (see
+            // "TaskPool::Run()"). The first exception thrown (if
+            // any) is stored and rethrown once all chunks are done
+            // (the chunks of other threads are still fully
+            // processed).
+            ///////////////////////////////////////////////////////////
+            TaskPool &pool = policy.Pool();
+            const std::size_t chunkCount = std::max(std::size_t(1),
+                                                    std::min(pool.ThreadCount() + 1, rowCount / minRowsPerChunk));
+            const std::size_t rowsPerChunk = (rowCount + chunkCount - 1) / chunkCount;
+
+            std::atomic<bool> failed(false);
+            std::exception_ptr exception;
+            const auto processChunk = [&](const std::size_t chunk) noexcept
+                                      {
+                                          const std::size_t begin = std::min(rowCount, chunk * rowsPerChunk);
+                                          const std::size_t end = std::min(rowCount, begin + rowsPerChunk);
+                                          try
+                                          {
+                                              Private::BatchInvokeRows<F>(function, columnsTuple, begin, end, std::make_index_sequence<ArgCount>());
+                                          }
+                                          catch (...)
+                                          {
+                                              if (!failed.exchange(true))
+                                              {
+                                                  exception = std::current_exception();
+                                              }
+                                          }
+                                      };
+
+            pool.Run(chunkCount, processChunk);
+
+            if (exception)
+            {
+                std::rethrow_exception(exception);
+            }
+
+            return rowCount;
+        }
     #endif
 
-    /////////////////////////////////////////////////////////
-    // Defer to function template "ForEachTupleType()" just
-    // above, specializing it on the tuple type member of
-    // "FunctionTraitsT" (i.e., the "std::tuple" containing
-    // all non-variadic arg types for the function
-    // represented by "FunctionTraitsT"). All tuple types
-    // (i.e., all arg types in the "FunctionTraitsT"
-    // function) are therefore iterated, invoking "functor"
-    // for each (we pass the latter).
-    /////////////////////////////////////////////////////////
-    return ForEachTupleType<FunctionTraitsArgTypes_t<FunctionTraitsT>>(std::forward<ForEachTupleFunctorT>(functor));
+    Private::BatchInvokeRows<F>(function, columnsTuple, 0, rowCount, std::make_index_sequence<ArgCount>());
+    return rowCount;
 }
 
-///////////////////////////////////////////////////////////////////
-// ForEachArg(). Thin wrapper around "ForEachFunctionTraitsArg()"
-// just above. Simply creates a "FunctionTraits" from the function
-// given by template arg "F" and then invokes the latter function.
-// Therefore iterates all tuple elements corresponding to each
-// (non-variadic) arg in function "F" (or none if "F" has no
-// non-variadic args) and invokes "functor" for each. See above
-// function for further details.
-// 
-// Note that you should normally rely on the following function
-// instead of "ForEachFunctionTraitsArg()" above since it's easier
-// (though you're free to use the latter function if you've already
-// created a "FunctionTraits" for other purposes). The following
-// provides the same example seen in "ForEachFunctionTraitsArg()"
-// to demonstrate this.
+/////////////////////////////////////////////////////////////////////////////
+// FunctionDescriptor. Describes a function registered in a
+// "FunctionRegistry" (see this for details), i.e., the name it was
+// registered under (and its "Fnv1aHash()"), and what "FunctionTraits"
+// reports about its type. "Signature" is its "SignatureName_v", and
+// "Layout" points to its "SignatureDescriptor_v" (whose "TypeDescriptor"s
+// provide the name, hash, size, etc. of its return type and each arg
+// type). All strings refer to static storage except "Name" (which refers
+// to whatever was passed to "MakeFunctionDescriptor()").
+/////////////////////////////////////////////////////////////////////////////
+struct FunctionDescriptor
+{
+    tstring_view Name;
+    std::uint64_t NameHash;
+    tstring_view Signature;
+    tstring_view CallingConventionName;
+    std::size_t ArgCount;
+    bool IsNoexcept;
+    bool IsVariadic;
+    const SignatureDescriptor *Layout;
+};
+
+/////////////////////////////////////////////////////////////////////////////
+// MakeFunctionDescriptor(). Returns the "FunctionDescriptor" for a
+// function of type "F" registered under "name" (see "FunctionDescriptor"
+// just above). Note that "name" must outlive the descriptor (it's normally
+// a string literal).
+/////////////////////////////////////////////////////////////////////////////
+template <TRAITS_FUNCTION_C F>
+inline constexpr FunctionDescriptor MakeFunctionDescriptor(tstring_view name) noexcept
+{
+    return FunctionDescriptor{name,
+                              Fnv1aHash(name),
+                              SignatureName_v<F>,
+                              CallingConventionName_v<F>,
+                              ArgCount_v<F>,
+                              IsNoexcept_v<F>,
+                              IsVariadic_v<F>,
+                              &SignatureDescriptor_v<F>};
+}
+
+///////////////////////////////////////////////////////////////////////////
+// For internal use only (by "FunctionRegistry" just after this namespace)
+///////////////////////////////////////////////////////////////////////////
+STDEXT_BEGIN_PRIVATE
+{
+    ///////////////////////////////////////////////////////////////////////
+    // Assumed size of a cache line (true of all mainstream x86-64 and
+    // ARM64 processors at this writing). Used instead of
+    // "std::hardware_destructive_interference_size" which isn't
+    // available on all supported compilers (and whose value GCC warns
+    // may differ between translation units).
+    ///////////////////////////////////////////////////////////////////////
+    inline constexpr std::size_t CacheLineSize = 64;
+
+    ///////////////////////////////////////////////////////////////////////
+    // Returns the home slot of "hash" in a table of "2 ^ (64 - shift)"
+    // slots (multiplicative hashing, keeping the top "64 - shift" bits,
+    // so the result is always less than "2 ^ (64 - shift)")
+    ///////////////////////////////////////////////////////////////////////
+    inline constexpr std::size_t HomeSlot(std::uint64_t hash, unsigned shift) noexcept
+    {
+        return static_cast<std::size_t>((hash * 0x9E3779B97F4A7C15ULL) >> shift);
+    }
+} // namespace Private
+STDEXT_END_PRIVATE
+
+/////////////////////////////////////////////////////////////////////////////
+// FunctionRegistry. Registry of up to "CapacityT" functions (each described
+// by a "FunctionDescriptor" - see this for details) looked up by name, for
+// exposing functions to a scripting layer for instance. Functions are
+// registered (normally at startup, either during static initialization or
+// at compile time since every member is "constexpr") and the registry is
+// then frozen by calling "Freeze()", after which it's immutable (no more
+// functions can be registered) and lookups via "Find()" can proceed. Since
+// lookups only ever read the (immutable) table they never lock, so any
+// number of threads can perform them concurrently, provided the registry
+// was frozen before they started (or it's published to them in some other
+// thread-safe way after being frozen). "Find()" returns "nullptr" until the
+// registry is frozen.
+//
+// The table is an open-addressed hash table twice the size of "CapacityT"
+// (rounded up to a power of 2) using linear probing, so lookups normally
+// succeed (or fail) on the first probe. The hashes of the names are stored
+// in their own cache-line-aligned array (separate from the descriptors) so
+// probing only touches the hashes, and only the matching descriptor itself
+// is then read. Note that since the constructor is "constexpr" a registry
+// with static storage duration is always constant-initialized, so
+// functions can safely be registered in it during the dynamic
+// initialization of other objects (in any translation unit). Registered
+// names must outlive the registry (they're normally string literals).
 //
 //     Example
 //     -------
-//     ///////////////////////////////////////////////////
-//     // Prototype of some function whose arg types you
-//     // wish to iterate (display in this example - see
-//     // "displayArgType" lambda below). Note that we're
-//     // using a raw C++ function type in this example
-//     // (just a free-function prototype), but pointers
-//     // and references to functions are also supported
-//     // (though references to non-static member functions
-//     // are illegal in C++), as well as references to
-//     // pointers, and non-overloaded functors (or
-//     // references to functors)
-//     ///////////////////////////////////////////////////
-//     int SomeFunc(int arg1, float arg2, double arg3);
+//     int Add(int, int) noexcept;
+//     void Log(const char *format, ...);
 //
-//     /////////////////////////////////////////////////////////////////
-//     // Lambda that will be invoked just below, once for each arg in
-//     // "SomeFunc()" above (where template arg "I" is the zero-based
-//     // "Ith" argument of "SomeFunc()", and "ArgTypeT" is its type).
-//     // Note that lambda templates are supported in C++20 and later
-//     // only. For C++17 (this header doesn't support earlier versions),
-//     // you need to roll your own functor instead (with a template
-//     // version of "operator()" equivalent to this lambda)
-//     /////////////////////////////////////////////////////////////////
-//     const auto displayArgType = []<std::size_t I, typename ArgTypeT>()
-//                                 {
-//                                     //////////////////////////////////////////////////////
-//                                     // Display the type of the (zero-based) "Ith" arg in
-//                                     // "SomeFunc" using the following format (shown here
-//                                     // for "I" equals zero so "ArgTypeT" is therefore an
-//                                     // "int", but whatever "I" and "ArgTypeT" are on each
-//                                     // iteration - note that we increment zero-based "I"
-//                                     // by 1 however to display it as 1-based since it's
-//                                     // more natural for display purposes):
-//                                     //
-//                                     //    1) int
-//                                     //
-//                                     // Note that we never come through here if function
-//                                     // "F" has no args (or variadic args only - variadic
-//                                     // args aren't processed)
-//                                     //////////////////////////////////////////////////////
-//                                     tcout << (I + 1) << _T(") ") << TypeName_v<ArgTypeT> << _T("\n");
+//     FunctionRegistry<256> registry;
 //
-//                                     //////////////////////////////////////////////
-//                                     // Return true to continue iterating (false
-//                                     // would stop iterating, equivalent to a
-//                                     // "break" statement in a regular "for" loop)
-//                                     //////////////////////////////////////////////
-//                                     return true;
-//                                 };
+//     // At startup
+//     registry.Register<decltype(Add)>(_T("Add"));
+//     registry.Register<decltype(Log)>(_T("Log"));
+//     registry.Freeze();
 //
-//     ///////////////////////////////////////////////////////////////
-//     // Iterate all argument types in "SomeFunc", invoking
-//     // "displayArgType" above for each. Outputs the following:
-//     //
-//     //     1) int
-//     //     2) float
-//     //     3) double
-//     //
-//     // Note that "ForEachArg" returns true if the functor you pass
-//     // ("displayArgType" in this example) returns true or false
-//     // otherwise (useful if your functor needs to "break" like a
-//     // normal "for" loop for some reason - iteration immediately
-//     // stops if it returns false and the following therefore
-//     // returns false). Always returns true in the above example
-//     // (and typically in most real-world code as well)
-//     ///////////////////////////////////////////////////////////////
-//     using F = decltype(SomeFunc);
-//     ForEachArg<F>(displayArgType);
-///////////////////////////////////////////////////////////////////
-template <TRAITS_FUNCTION_C F, FOR_EACH_TUPLE_FUNCTOR_C ForEachTupleFunctorT>
-inline constexpr bool ForEachArg(ForEachTupleFunctorT&& functor)
+//     // Any thread (no locking)
+//     if (const FunctionDescriptor *descriptor = registry.Find(_T("Add")))
+//     {
+//         // "int (int, int) noexcept", 2, etc.
+//         tstring_view signature = descriptor->Signature;
+//         std::size_t argCount = descriptor->ArgCount;
+//     }
+/////////////////////////////////////////////////////////////////////////////
+template <std::size_t CapacityT>
+class FunctionRegistry
 {
-    // See this constant for details
-    #if !CONCEPTS_SUPPORTED
-        /////////////////////////////////////////////////////
-        // Kicks in if concepts not supported, otherwise
-        // TRAITS_FUNCTION_C concept kicks in above instead
-        // (latter simply resolves to the "typename" keyword
-        // when concepts aren't supported)
-        /////////////////////////////////////////////////////
-        STATIC_ASSERT_IS_TRAITS_FUNCTION(F);
+    static_assert(CapacityT != 0, "\"CapacityT\" must be greater than zero");
 
-        ///////////////////////////////////////////////
-        // Kicks in if C++ 17 or earlier, otherwise
-        // FOR_EACH_TUPLE_FUNCTOR_C concept kicks in
-        // above instead (latter simply resolves to
-        // the "typename" keyword in C++17 or earlier)
-        ///////////////////////////////////////////////
-        STATIC_ASSERT_IS_FOR_EACH_TUPLE_FUNCTOR(ForEachTupleFunctorT)
-    #endif
+public:
+    // Maximum number of functions that can be registered
+    static constexpr std::size_t Capacity = CapacityT;
+
+    constexpr FunctionRegistry() noexcept = default;
+
+    ////////////////////////////////////////////////////////////////
+    // Registers "descriptor" (normally created by
+    // "MakeFunctionDescriptor()"). Returns true if registered or
+    // false if the registry is already frozen, full, or a function
+    // with the same name is already registered.
+    ////////////////////////////////////////////////////////////////
+    constexpr bool Register(const FunctionDescriptor &descriptor) noexcept
+    {
+        if (m_IsFrozen || m_Count == Capacity)
+        {
+            return false;
+        }
+
+        const std::uint64_t hash = SlotHash(descriptor.NameHash);
+        std::size_t index = Probe(hash, descriptor.Name);
+        if (m_Hashes[index] != 0)
+        {
+            return false; // Already registered
+        }
+
+        m_Hashes[index] = hash;
+        m_Descriptors[index] = descriptor;
+        ++m_Count;
+
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Registers a function of type "F" under "name" (see
+    // "MakeFunctionDescriptor()" and the overload just above)
+    ////////////////////////////////////////////////////////////////
+    template <TRAITS_FUNCTION_C F>
+    constexpr bool Register(tstring_view name) noexcept
+    {
+        return Register(MakeFunctionDescriptor<F>(name));
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Freezes the registry (see class comments above). Once frozen
+    // no more functions can be registered and "Find()" can be
+    // called (from any number of threads).
+    ////////////////////////////////////////////////////////////////
+    constexpr void Freeze() noexcept
+    {
+        m_IsFrozen = true;
+    }
+
+    constexpr bool IsFrozen() const noexcept
+    {
+        return m_IsFrozen;
+    }
+
+    // Number of functions registered
+    constexpr std::size_t Count() const noexcept
+    {
+        return m_Count;
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Returns the descriptor of the function registered under
+    // "name", or "nullptr" if there's none (or the registry isn't
+    // frozen yet)
+    ////////////////////////////////////////////////////////////////
+    constexpr const FunctionDescriptor *Find(tstring_view name) const noexcept
+    {
+        if (!m_IsFrozen)
+        {
+            return nullptr;
+        }
+
+        const std::size_t index = Probe(SlotHash(Fnv1aHash(name)), name);
+
+        return m_Hashes[index] != 0 ? &m_Descriptors[index] : nullptr;
+    }
+
+private:
+    static constexpr unsigned Log2Size = Private::DispatchTableLog2Size(Capacity);
+    static constexpr std::size_t Size = std::size_t(1) << Log2Size;
+    static constexpr unsigned Shift = 64 - Log2Size;
 
     ///////////////////////////////////////////////////////////
-    // Create (specialize) a "FunctionTraits" from "F" and
-    // defer to function template "ForEachFunctionTraitsArg()"
-    // just above (the "FunctionTraits" version of this
-    // function). All non-variadic arg types for the function
-    // represented by "FunctionTraitsT" are therefore iterated,
-    // invoking "functor" for each (we pass the latter).
+    // Hash stored in "m_Hashes" for a name whose hash is
+    // "nameHash" (zero is reserved for empty slots)
     ///////////////////////////////////////////////////////////
-    return ForEachFunctionTraitsArg<FunctionTraits<F>>(std::forward<ForEachTupleFunctorT>(functor));
-}
+    static constexpr std::uint64_t SlotHash(std::uint64_t nameHash) noexcept
+    {
+        return nameHash != 0 ? nameHash : 1;
+    }
+
+    ///////////////////////////////////////////////////////////
+    // Returns the index of the slot storing "name" (whose slot
+    // hash is "hash"), or the index of the empty slot where it
+    // would be stored if it's not in the table. The table is
+    // never more than half full so an empty slot always exists.
+    ///////////////////////////////////////////////////////////
+    constexpr std::size_t Probe(std::uint64_t hash, tstring_view name) const noexcept
+    {
+        std::size_t index = Private::HomeSlot(hash, Shift);
+        while (m_Hashes[index] != 0 &&
+               (m_Hashes[index] != hash || m_Descriptors[index].Name != name))
+        {
+            index = (index + 1) & (Size - 1);
+        }
+
+        return index;
+    }
+
+    alignas(Private::CacheLineSize) std::uint64_t m_Hashes[Size] = {};
+    FunctionDescriptor m_Descriptors[Size] = {};
+    std::size_t m_Count = 0;
+    bool m_IsFrozen = false;
+};
 
 } // namespace StdExt
 
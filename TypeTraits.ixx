@@ -0,0 +1,139 @@
+/////////////////////////////////////////////////////////////////////////////
+// LICENSE NOTICE
+// --------------
+// Copyright (c) Hexadigm Systems
+//
+// Permission to use this software is granted under the following license:
+// https://www.hexadigm.com/GenericLib/License.html
+//
+// This copyright notice must be included in this and all copies of the
+// software as described in the above license.
+//
+// DESCRIPTION
+// -----------
+// EXPERIMENTAL. C++20 named module interface unit for "TypeTraits.h",
+// allowing you to write:
+//
+//     import StdExt.TypeTraits;
+//
+// instead of #including "TypeTraits.h" (C++20 or later only). Note that
+// the module hasn't been shown to work on any compiler to date. It's
+// unusable on GCC 12 and earlier (GCC 12 builds it but miscompiles
+// importers - see the #error below), and untested on MSVC, Clang and
+// later versions of GCC, so its effect on build times (compared to
+// #including "TypeTraits.h") hasn't been measured either. Prefer #including "TypeTraits.h" (or precompiling
+// it as described further below) until it's been verified on your
+// compiler.
+//
+// The module #includes "TypeTraitsNativeHeaders.h" in its global module
+// fragment (all native headers that "TypeTraits.h" depends on, under the
+// same conditions), along with the macros in "CompilerVersions.h" (but not
+// its declarations). It then #includes "CompilerVersions.h" and
+// "TypeTraits.h" in its module purview with STDEXT_EXPORT #defined as
+// "export" (see this in "CompilerVersions.h"), so everything in namespace
+// "StdExt" is exported except for "StdExt::Private" (reserved for internal
+// use - see STDEXT_BEGIN_PRIVATE in "CompilerVersions.h"). The API is
+// therefore intended to be identical to the one you get when #including
+// "TypeTraits.h", including all "FunctionTraits" specializations, which
+// are then parsed and compiled just once into the module's BMI, i.e., its
+// "binary module interface", instead of once in every translation unit
+// that uses them. Note however that macros are never exported by a module
+// (by definition), so if you need any macros that "TypeTraits.h" or
+// "CompilerVersions.h" #define (such as "_T", "CPP20_OR_LATER",
+// "TRAITS_FUNCTION_C", etc.), then #include "CompilerVersions.h" as well
+// (the concept macros such as "TRAITS_FUNCTION_C" aren't required in C++20
+// however since you can just use the concepts themselves, such as
+// "TraitsFunction_c", which the macros resolve to). The same #defined
+// constants you would normally #define before #including "TypeTraits.h"
+// (such as STDEXT_USE_THREADS) must be #defined when compiling this file
+// (normally via the compiler's command line) to take effect in the module.
+//
+// Building the module depends on your compiler and build system. The
+// following is just a guide (untested, as noted above):
+//
+//     MSVC:  cl /std:c++20 /EHsc /interface /c TypeTraits.ixx
+//            (the resulting "StdExt.TypeTraits.ifc" is then found
+//            automatically by "cl" when in the same folder, or via
+//            "/reference StdExt.TypeTraits=StdExt.TypeTraits.ifc")
+//     Clang: clang++ -std=c++20 -x c++-module --precompile TypeTraits.ixx -o StdExt.TypeTraits.pcm
+//            (then pass "-fmodule-file=StdExt.TypeTraits=StdExt.TypeTraits.pcm"
+//            when compiling each importer)
+//     GCC:   Not supported on GCC 12 or earlier (see the #error
+//            below). Later versions are untested, but would be built
+//            with "g++ -std=c++20 -fmodules-ts -x c++ -c TypeTraits.ixx"
+//            (the BMI is written to the "gcm.cache" folder and
+//            importers must also be compiled with "-fmodules-ts")
+//
+// CMake 3.28 or later can also build it via "target_sources(... FILE_SET
+// CXX_MODULES FILES TypeTraits.ixx)".
+//
+// Lastly, if modules aren't an option then "TypeTraits.h" is also suitable
+// for use as (or in) a precompiled header as-is (it's self-contained and
+// its only dependencies are "CompilerVersions.h",
+// "TypeTraitsNativeHeaders.h" and native headers), so it can simply be
+// #included in your existing precompiled header (such as "pch.h" or
+// "stdafx.h" in MSFT projects), or precompiled directly (such as
+// "g++ -std=c++17 -x c++-header TypeTraits.h" in GCC, producing
+// "TypeTraits.h.gch", which GCC then picks up automatically when you
+// #include "TypeTraits.h").
+/////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////
+// Global module fragment. Only preprocessor directives can
+// appear here, normally #includes of legacy headers as seen
+// below, whose declarations are attached to the global module
+// (not this one). All native headers #included by
+// "CompilerVersions.h" and "TypeTraits.h" must be #included
+// here, so that their own #includes (in the module purview
+// further below) are no-ops (due to their #include guards).
+// Otherwise the native headers would be attached to this
+// module instead, which is an error. We therefore #include
+// "CompilerVersions.h" here with STDEXT_MACROS_ONLY #defined
+// (its macros and the native headers it #includes, but not
+// its declarations, which must be exported from the module
+// purview instead), followed by "TypeTraitsNativeHeaders.h",
+// which #includes all native headers "TypeTraits.h" depends
+// on (and which "TypeTraits.h" itself #includes, so the two
+// can't get out of sync).
+//////////////////////////////////////////////////////////////
+module;
+
+//////////////////////////////////////////////////////////////
+// GCC 12 and earlier miscompile code that imports this module
+// (any "std::string_view" constructed from a string literal in
+// an importer, including the one "TypeName_v" relies on, reads
+// garbage and normally crashes), and also return the wrong
+// names from "TypeName_v" at compile time. These are compiler
+// bugs that can't be worked around here, so #include
+// "TypeTraits.h" instead (or precompile it) on these versions.
+// Note that Clang and Intel also #define __GNUC__.
+//////////////////////////////////////////////////////////////
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__INTEL_COMPILER) && \
+    !defined(__INTEL_LLVM_COMPILER) && __GNUC__ <= 12
+    #error "The \"StdExt.TypeTraits\" module isn't supported on GCC 12 or earlier (GCC miscompiles importers). #include \"TypeTraits.h\" instead."
+#endif
+
+#define STDEXT_MACROS_ONLY
+#include "CompilerVersions.h"
+#include "TypeTraitsNativeHeaders.h"
+#undef STDEXT_MACROS_ONLY
+
+export module StdExt.TypeTraits;
+
+/////////////////////////////////////////////////////////
+// Module purview. Everything declared by the following
+// headers in namespace "StdExt" is exported, except for
+// "StdExt::Private" (see STDEXT_EXPORT and
+// STDEXT_BEGIN_PRIVATE in "CompilerVersions.h"). Note
+// that "CompilerVersions.h" #defined all three macros
+// (to their defaults) in the global module fragment
+// above, and now only processes its declarations.
+/////////////////////////////////////////////////////////
+#undef STDEXT_EXPORT
+#undef STDEXT_BEGIN_PRIVATE
+#undef STDEXT_END_PRIVATE
+#define STDEXT_EXPORT export
+#define STDEXT_BEGIN_PRIVATE } namespace StdExt::Private
+#define STDEXT_END_PRIVATE export namespace StdExt {
+#include "CompilerVersions.h"
+#include "TypeTraits.h"
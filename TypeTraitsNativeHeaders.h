@@ -0,0 +1,111 @@
+#ifndef TYPETRAITS_NATIVE_HEADERS
+#define TYPETRAITS_NATIVE_HEADERS
+
+/////////////////////////////////////////////////////////////////////////////
+// LICENSE NOTICE
+// --------------
+// Copyright (c) Hexadigm Systems
+//
+// Permission to use this software is granted under the following license:
+// https://www.hexadigm.com/GenericLib/License.html
+//
+// This copyright notice must be included in this and all copies of the
+// software as described in the above license.
+//
+// DESCRIPTION
+// -----------
+// #includes all native headers (C++ standard headers and the native Windows
+// header "tchar.h" on MSFT platforms) that "TypeTraits.h" depends on, under
+// the conditions it depends on them (along with "CompilerVersions.h", for
+// the macros tested below). #included by "TypeTraits.h" itself, and by the
+// global module fragment of "TypeTraits.ixx", which must #include them all
+// before its module purview (see that file). Any native header required by
+// "TypeTraits.h" must therefore be #included here, never in "TypeTraits.h"
+// itself. Note that only preprocessor directives may appear in this file
+// (since it's #included in a global module fragment), and it has no use
+// on its own (#include "TypeTraits.h" instead).
+/////////////////////////////////////////////////////////////////////////////
+
+#include "CompilerVersions.h"
+
+//////////////////////////////////////////////////////////////
+// "TypeTraits.h" supports C++17 and later only (see this in
+// that file)
+//////////////////////////////////////////////////////////////
+#if CPP17_OR_LATER
+
+// Standard C/C++ headers
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/////////////////////////////////////////////////////////////
+// MSFT compiler? Note that Intel also #defines _MSC_VER on
+// Windows, as well as _MSC_FULL_VER and _MSC_EXTENSIONS.
+// See the following:
+//
+// https://github.com/cpredef/predef/blob/master/Compilers.md#user-content-microsoft-visual-c
+// https://www.intel.com/content/www/us/en/docs/cpp-compiler/developer-guide-reference/2021-8/additional-predefined-macros.html
+/////////////////////////////////////////////////////////////
+#if defined(_MSC_VER)
+    #include <tchar.h>
+#endif
+
+/////////////////////////////////////////////////////////////
+// STDEXT_USE_THREADS. Opt-in #defined constant you can
+// #define before #including "TypeTraits.h" to enable the
+// (few) multi-threaded features it provides, such as the
+// "ForEachParallel" execution policy (see this for
+// details). Off by default since it requires the native
+// C++ thread headers below (and on some platforms linking
+// with a threads library, such as "-pthread" on GCC and
+// Clang), which most users of "TypeTraits.h" don't need.
+/////////////////////////////////////////////////////////////
+#if defined(STDEXT_USE_THREADS)
+    #include <atomic>
+    #include <condition_variable>
+    #include <exception>
+    #include <mutex>
+    #include <thread>
+    #include <vector>
+#endif
+
+/////////////////////////////////////////////////////////////
+// STDEXT_NO_REFLECTION. Opt-out #defined constant you can
+// #define before #including "TypeTraits.h" to prevent
+// "TypeName_v" from using C++26 static reflection when the
+// compiler supports it (see REFLECTION_SUPPORTED in
+// "CompilerVersions.h"), so it parses __PRETTY_FUNCTION__
+// (or __FUNCSIG__) instead as it does on all other
+// compilers. Only required if you depend on the exact names
+// the latter produce (or on "TypeHash_v" values computed
+// from them), since the compiler is free to format the
+// names returned by reflection differently. Note that
+// reflection is also never used when TCHAR is "wchar_t"
+// (MSFT Unicode builds), since it only returns "char"
+// strings (see "Private::TypeNameImpl" in "TypeTraits.h").
+//
+// TYPENAME_USES_REFLECTION is for internal use only and
+// resolves to 1 if "TypeName_v" uses reflection or 0
+// otherwise (the only place that decides this, so the
+// <meta> header is #included under the same condition in
+// "TypeTraits.h" and "TypeTraits.ixx"). "TypeTraits.h"
+// #undefines it just after "Private::TypeNameImpl" when
+// it's done with it.
+/////////////////////////////////////////////////////////////
+#if REFLECTION_SUPPORTED && !defined(STDEXT_NO_REFLECTION) && !defined(_UNICODE)
+    #define TYPENAME_USES_REFLECTION 1
+    #include <meta>
+#else
+    #define TYPENAME_USES_REFLECTION 0
+#endif
+
+#endif // #if CPP17_OR_LATER
+#endif // TYPETRAITS_NATIVE_HEADERS (#include guard)
\ No newline at end of file